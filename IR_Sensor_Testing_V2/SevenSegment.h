@@ -9,10 +9,19 @@
 int NumToBin[10] = {0b11000000, 0b11111001, 0b10100100, 0b10110000, 0b10011001, 0b10010010, 0b10000010, 0b11111000, 0b10000000, 0b10011000};
 
 void InitPins(void);
-void SendToDisplay(float Speed){
-    int DecimalDigit = (Speed - (int)Speed)*10;
-    int TensDigit = (int)(Speed/10);
-    int OnesDigit = ((int)Speed)%10;
+//
+// Speed in tenths of mph - 99.9 most shown
+//
+void SendToDisplay(uint32_t Speed){
+    int DecimalDigit;
+    int TensDigit;
+    int OnesDigit;
+
+    if(Speed > 999)
+        Speed = 999;
+    DecimalDigit = Speed % 10;
+    TensDigit = Speed / 100;
+    OnesDigit = (Speed / 10) % 10;
 
     //printf("Input:%f, Tens:%i, Ones:%i, Decimal:%i\n", Speed, TensDigit, OnesDigit, DecimalDigit);
     P9->OUT = NumToBin[TensDigit];
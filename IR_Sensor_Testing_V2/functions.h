@@ -32,7 +32,6 @@ void pin_setup(void){
     P9->DIR |= 0xFF;  P9->OUT = 0;
     P10->DIR |= 0xFF; P10->OUT = 0;
 
-    P7->DIR |=  BIT7;
     P5->DIR &= ~BIT4;
     P2->DIR |=  0b111;
     P2->OUT &= ~0b111;
@@ -43,19 +42,13 @@ void pin_setup(void){
     //P5->SEL1 |= 0x04;
     P5->DIR |= BIT5; // output for P5.5
 
-    // Timer
-    P7->SEL1 &= ~BIT7; //Change pin functionality to TIMERA1
-    P7->SEL0 |= BIT7;  //A1.1 output pin
-    P7->DIR |= BIT7;   //Actual Output
+    // Timer - 1kHz square wave on P2.4 (TA0.1)
+    // Was TA1.1 on P7.7 - TIMER_A1 now free runs for the speed capture
+    P2->SEL1 &= ~BIT4; //Change pin functionality to TIMERA0
+    P2->SEL0 |= BIT4;  //A0.1 output pin
+    P2->DIR |= BIT4;   //Actual Output
 
-    // Input pin for IR receiver
-    P6->SEL0 &= ~BIT0;
-    P6->SEL1 &= ~BIT0;
-
-    P6->DIR &= ~BIT(1); //Sets P6 BIT1 to an input
-    P6->IES |= (BIT1);             // Falling edge interrupt maybe
-    P6->IE |= BIT1;                 //Interrupt Enable
-    NVIC->ISER[1] |= BIT(PORT6_IRQn-32); //enable for 6 interrupt
+    // Input pin for IR receiver - P8.0 (TA1.0), set up by Cap_Init
 
     return;
 }
@@ -77,38 +70,46 @@ NVIC->ISER[0] |= 0x01000000; // ISER0 starts at 0
 return;
 }
 
+//========================================================================================================//
+/*
+ * Name: uint8_t square_clock(uint8_t when, const Clock_freq_t *next)
+ * Description: Clock_notify routine - keeps the square wave at 1kHz when the governor changes SMCLK
+ * Inputs: when - CLOCK_BEFORE / CLOCK_AFTER, next - the new clock frequencies
+ * Output: 0 - never refuses
+ */
+//========================================================================================================//
+uint8_t square_clock(uint8_t when, const Clock_freq_t *next){
+    if(when == CLOCK_AFTER){
+        TIMER_A0->CCR[0] = next->smclk / 2000 - 1;
+        if(TIMER_A0->R > TIMER_A0->CCR[0])
+            TIMER_A0->CTL |= TIMER_A_CTL_CLR;   // past the new end - start the period again
+    }
+    return 0;
+}
+
 //========================================================================================================//
 /*
  * Name: void initTimer(void)
- * Description: creates a timer that will count every second
+ * Description: 1kHz square wave on P2.4 (TA0.1) - TIMER_A0 counts SMCLK up to CCR0 (2kHz) and the
+ *              output toggles each time (no interrupt). Moved from TA1.1 on P7.7 - TIMER_A1 free
+ *              runs for the speed capture, where CCR1 would toggle only every 65536 counts (~91.5Hz)
  * Inputs: NA
  * Output: NA
  */
 //========================================================================================================//
 void initTimer(void){
 
+    TIMER_A0->CTL = TIMER_A_CTL_SSEL__SMCLK | TIMER_A_CTL_CLR;
+    TIMER_A0->EX0 = 0;                  // divide by 1
 
-    //Set up SMCLK (12,000,000), Set mode to UpDown, Clear timer, Set ID bit to 1
-    TIMER_A1->CTL |= TIMER_A_CTL_SSEL__SMCLK | TIMER_A_CTL_MC__UP | TIMER_A_CTL_CLR | TIMER_A_CTL_ID__1;
-    //Set EX Bit to 8 to have the N value = 8
-    TIMER_A1->EX0 |= TIMER_A_EX0_IDEX__1;
-
-    //Set output mode to toggle and enable interrupt
-    TIMER_A1->CCTL[1] |= TIMER_A_CCTLN_OUTMOD_4 | TIMER_A_CCTLN_CCIE;
-
-    //Set Top value 1Hz square wave
-    //TIMER_A1-> CCR[0] = 15999;
-    //TIMER_A1-> CCR[1] = 15999;
-
-    TIMER_A1-> CCR[0] = 5999;
-    TIMER_A1-> CCR[1] = 5999;
+    //Set output mode to toggle
+    TIMER_A0->CCTL[1] = TIMER_A_CCTLN_OUTMOD_4;
 
-    //P7->SEL1 &= ~BIT7; //Change pin functionallity to TIMERA1
-    //P7->SEL0 |= BIT7;  //A1.1 output pin
-    //P7->DIR |= BIT7;   //Actual Output
+    TIMER_A0-> CCR[0] = Clock_SMCLK_freq / 2000 - 1;   // 5999 at 12MHz
+    TIMER_A0-> CCR[1] = 0;
 
-    NVIC->ISER[0] |= 0b100000000000; //Interrupt Enable
-    NVIC->ISER[0] |= NVIC_IPR4_PRI_16_OFS;
+    TIMER_A0->CTL |= TIMER_A_CTL_MC__UP;
+    Clock_notify(square_clock);
 }
 
 
@@ -17,99 +17,164 @@
 void pin_setup(void);
 void NVIC_setup(void);
 void initTimer(void);
+void speed_capture(uint32_t period);
+void speed_update(uint32_t period);
+void display_update(uint32_t ev);
+void display_tick(void);
+void gov_update(uint32_t ev);
+void gov_tick(void);
 
 // Global Variables
-float Revolutions = 0;
-float Speed = 0;
-float RPM = 0;
-// Diameter = 146mm or 0.479003 ft
-float Diameter = 0.479003;
-float pi = 3.14159262;
-int clear = 0;
-float circ = 1.047; //Circumference in feet
-float RevPerMi = 5042.029;
-// Variable for number of ms
-int mili = 0;
+// Speed in tenths of mph - wheel size is in msoe_lib_speed.h (SPEED_REV_PER_MI)
+uint32_t Speed = 0;
+// Speed task - the capture interrupt posts the period between pulses
+static uint32_t speed_q[8];
+int8_t speed_task;
+// Periods filtered - a median of 5 drops split and missed pulses, then a 4 period average
+Filt_t speed_filt;
+static const Filt_cfg_t speed_filt_cfg = {FILT_MEDIAN | FILT_AVG, 4, 0};
+// Display task - a software timer posts 5 times a second
+static uint32_t display_q[2];
+int8_t display_task;
+#define DISPLAY_TICKS   2       // 200ms (100ms timer ticks)
+#define DISPLAY_STOP    10      // updates with no period before showing 0 (2s - ~0.4mph)
+// Governor task - a software timer posts every 100ms
+static uint32_t gov_q[4];
+int8_t gov_task;
 
 
 void main(void){
 
     WDT_A->CTL = WDT_A_CTL_PW | WDT_A_CTL_HOLD;  //Disable Watchdog Timer
-    Clock_Init_48MHz();
+    Clock_Init_48MHz_fast();    // runs at 12MHz from the DCO until the crystal is up
+                                // SMCLK (TIMER_A1) is 12MHz either way
 
     // Setup Function Calls
     pin_setup();
-    initTimer();
     NVIC_setup();
 
     P5->OUT = 0b00000000;
-    P6->OUT &= ~BIT1;
 
 
-    // Need to enable interrupts before program starts
-    _enable_interrupts();
+    Filt_Init(&speed_filt, &speed_filt_cfg);
+    speed_task = Sched_task(speed_update, 0, speed_q, 8);
+    display_task = Sched_task(display_update, 1, display_q, 2);
+    gov_task = Sched_task(gov_update, 1, gov_q, 4);
 
-    //Local Variables
+    // Clock governor - load from the time asleep
+    Time_Init();
+    Sched_clock(Time_now_us);
+    Timer_Init(Clock_MCLK_freq, 10);
+    Timer_start(gov_tick, 1, 0);
+    Timer_start(display_tick, DISPLAY_TICKS, 0);
 
-    while(1){ // Main while loop
+    // 1kHz square wave on P2.4
+    initTimer();
 
-        //Low power code will be here eventually
-        //For now, do nothing because yeet.
+    // IR receiver on P8.0 - TIMER_A1 latches each pulse
+    // Edges within 6ms of the last (faster than 10000 RPM - ~119mph) are noise, counted in Cap_spurious
+    Cap_Init(speed_capture);
+    Cap_lockout(CAP_RPM_TICKS(10000));
 
+    // Need to enable interrupts before program starts
+    _enable_interrupts();
 
-    }
+    // Runs the speed task for each revolution and the display task at a fixed rate, sleeps in between
+    Sched_run();
 }
 
 //========================================================================================================//
 /*
- * Name: Interrupt handler
- * Description: handles the interrupt for the IR sensor
- * Inputs: NA
+ * Name: void speed_capture(uint32_t period)
+ * Description: Capture interrupt - one IR pulse per revolution. Hands the period to the speed task.
+ * Inputs: period - time for the revolution in 12MHz ticks
  * Output: NA
  */
 //========================================================================================================//
-void PORT6_IRQHandler(void){
-    int val; // tmp variable
-    val = P6->IV;
-    if(~(val | ~BIT1) == BIT1){      // if P6.1 is reading a value of 0
-
-        float currentMili;
-        currentMili = mili+1;
+void speed_capture(uint32_t period){
+    Sched_post(speed_task, period);     // speed math and display in speed_update
+    P5->OUT ^= BIT5;   // toggle
+}
 
-        Speed = (1/(currentMili*0.0014008))*2;
+//========================================================================================================//
+/*
+ * Name: void speed_update(uint32_t period)
+ * Description: Speed task - adds the revolution period to the filter. The display task shows it.
+ *              Runs from the main loop, not the interrupt.
+ * Inputs: period - time for the revolution in 12MHz ticks
+ * Output: NA
+ */
+//========================================================================================================//
+void speed_update(uint32_t period){
+    Filt_add(&speed_filt, period);
+}
 
-        SendToDisplay(Speed);
+//========================================================================================================//
+/*
+ * Name: void display_update(uint32_t ev)
+ * Description: Display task - converts the filtered period to tenths of mph and sends it to the display.
+ *              Shows 0 and starts the filter again once no period has come in for DISPLAY_STOP updates.
+ * Inputs: ev - not used
+ * Output: NA
+ */
+//========================================================================================================//
+void display_update(uint32_t ev){
+    static uint32_t last_count = 0;
+    static uint8_t idle = 0;
 
-        mili = 0;
+    if(Cap_count != last_count){
+        last_count = Cap_count;
+        idle = 0;
+    }
+    else if(idle < DISPLAY_STOP && ++idle == DISPLAY_STOP){
+        Filt_reset(&speed_filt);
+    }
+    Speed = Speed_tenths(speed_filt.out);
 
-        P5->OUT ^= BIT5;   // toggle
-        //Revolutions++;     // increment the number of revolutions that were measured.
-       }
+    SendToDisplay(Speed);
 }
 
 //========================================================================================================//
 /*
- * Name: void TA1_N_IRQHandler(void)
- * Description: Every second, we must read in the rps, convert to mph, and send that to the watch
- *              via Bluetooth.
+ * Name: void display_tick(void)
+ * Description: Software timer (SysTick, every DISPLAY_TICKS) - starts the display task
  * Inputs: NA
  * Output: NA
  */
 //========================================================================================================//
-void TA1_N_IRQHandler(void){
-
-    mili++;
-
-    /*RPM   = Revolutions*60*pi*Diameter; // calculates RPM in feet/minute
-    Speed = RPM*60/5280;                // calculates Speed in MPH
-
-    //call Zach's function to send the speed to the display
-    SendToDisplay(Speed);
+void display_tick(void){
+    Sched_post(display_task, 0);
+}
 
-    //Reset the revolutions variable
-    Revolutions = 0;
-    */
+//========================================================================================================//
+/*
+ * Name: void gov_update(uint32_t ev)
+ * Description: Governor task - slows the clock while the CPU is mostly asleep.
+ *              Starts once the fast start has switched to the crystal.
+ * Inputs: ev - not used
+ * Output: NA
+ */
+//========================================================================================================//
+void gov_update(uint32_t ev){
+    static int started = 0;
+
+    if(Clock_boot[0].result != 0)       // still on the DCO
+        return;
+    if(!started){
+        Gov_Init(0);
+        started = 1;
+    }
+    Gov_poll();
+}
 
-    //Clear Flag
-    clear = TIMER_A1->IV;
+//========================================================================================================//
+/*
+ * Name: void gov_tick(void)
+ * Description: Software timer (SysTick, 100ms) - starts the governor task
+ * Inputs: NA
+ * Output: NA
+ */
+//========================================================================================================//
+void gov_tick(void){
+    Sched_post(gov_task, 0);
 }
@@ -123,6 +123,7 @@ SECTIONS
     .vtable :   > 0x20000000
     .data   :   > SRAM_DATA
     .bss    :   > SRAM_DATA
+    .TI.noinit :  > SRAM_DATA      /* retained across resets (msoe_lib_clk boot profile) */
     .sysmem :   > SRAM_DATA
     .stack  :   > SRAM_DATA (HIGH)
 
@@ -0,0 +1,34 @@
+/*
+ * bat1_rle.h
+ *
+ *  Generated by host/bmp_rle_gen.c from bat1.h - 504 bytes run length encoded to 232
+ *  - do not edit, rerun the generator instead
+ *
+ */
+#ifndef __MSOE_LIB_BAT1_RLE_H__
+#define __MSOE_LIB_BAT1_RLE_H__
+////////////////////////////////////
+//
+// bat1.h for LCD_print_bmpRLE
+//
+////////////////////////////////////
+#include <stdint.h>
+
+static const uint8_t bat1_rle [] = {
+  0xD9,0x00,0x80,0x80,0x80,0xC0,0x81,0xE0,0x80,0x70,0x80,0xB0,0x04,0xB8,0xF8,0xD8,
+  0xD8,0xDC,0x81,0xFC,0x02,0x6C,0x2C,0x0C,0x83,0x0E,0x80,0x06,0x80,0xF6,0x87,0xE6,
+  0x80,0xF6,0x84,0x0E,0x80,0x0C,0x09,0x3C,0x7C,0xFC,0xDC,0xDC,0xD8,0xF8,0xB8,0xB8,
+  0xB0,0x81,0x70,0x81,0xE0,0x80,0xC0,0x80,0x80,0x85,0x00,0x0C,0xE0,0xF0,0xF8,0xFC,
+  0x1E,0x0F,0xE7,0xF3,0xFB,0xFD,0xFD,0xFE,0xFE,0x8A,0xFF,0x02,0xFD,0xF8,0xF8,0x83,
+  0xF0,0x02,0xF8,0xFC,0xFE,0x8B,0xFF,0x01,0xFC,0xF8,0x85,0xF0,0x00,0xF8,0x89,0xFF,
+  0x80,0xFE,0x15,0xFF,0xFD,0xFB,0xFB,0xF7,0xE7,0xCF,0x1E,0x3E,0xFC,0xF8,0xF0,0x07,
+  0x1F,0x3F,0x7F,0xF8,0xF0,0xEF,0xDF,0xFF,0xBF,0x87,0xFF,0x00,0xDF,0x82,0x0F,0x80,
+  0x1F,0x00,0x3F,0x81,0x7F,0x81,0x3F,0x80,0x1F,0x80,0x3F,0x00,0x7F,0x87,0xFF,0x00,
+  0x7F,0x84,0x3F,0x04,0x7F,0xFF,0xFF,0x7F,0x3F,0x83,0x1F,0x00,0xBF,0x86,0xFF,0x80,
+  0x7F,0x08,0xBF,0xDF,0xDF,0xEF,0xF0,0xF8,0x7F,0x3F,0x1F,0x84,0x00,0x80,0x01,0x80,
+  0x03,0x80,0x07,0x0B,0x0F,0x0E,0x0F,0x1F,0x1D,0x1D,0x1F,0x3B,0x3B,0x3A,0x38,0x30,
+  0x83,0x70,0x80,0x60,0x86,0xE0,0x06,0xE3,0xE7,0xEF,0xEF,0xE7,0xE3,0xE1,0x86,0xE0,
+  0x80,0x60,0x84,0x70,0x00,0x3A,0x81,0x3B,0x00,0x3F,0x81,0x1D,0x08,0x1F,0x0E,0x0F,
+  0x0F,0x07,0x07,0x03,0x01,0x01,0xD7,0x00 };
+
+#endif // __MSOE_LIB_BAT1_RLE_H__
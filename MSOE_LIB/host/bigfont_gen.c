@@ -0,0 +1,73 @@
+/*
+ * bigfont_gen.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     flattened big font strips from ASCII_BIG
+ *
+ *  Host (Linux) build step - writes msoe_lib_lcd_bigfont.h from the
+ *  ASCII_BIG table in msoe_lib_lcd_char.h
+ *
+ *  Rerun after changing ASCII_BIG, from MSOE_LIB:
+ *      gcc -std=c99 -I . -o bigfont_gen host/bigfont_gen.c
+ *      ./bigfont_gen > msoe_lib_lcd_bigfont.h
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <stdint.h>
+#include "msoe_lib_lcd_char.h"
+
+#define GLYPHS  (sizeof(ASCII_BIG) / sizeof(ASCII_BIG[0]))
+
+int main(void){
+    unsigned g;
+    unsigned half;
+    unsigned i;
+    uint8_t strip[10];
+
+    printf("/*\n"
+           " * msoe_lib_lcd_bigfont.h\n"
+           " *\n"
+           " *  Generated by host/bigfont_gen.c from ASCII_BIG in msoe_lib_lcd_char.h\n"
+           " *  - do not edit, rerun the generator instead\n"
+           " *\n"
+           " */\n"
+           "#ifndef __MSOE_LIB_LCD_BIGFONT_H__\n"
+           "#define __MSOE_LIB_LCD_BIGFONT_H__\n"
+           "\n"
+           "// Big character strips\n"
+           "//\n"
+           "// ASCII_BIG_STRIP[val - 0x20][half] is the 10 column strip for the upper (0)\n"
+           "// or lower (1) bank of a big character - 1 blank column, the 8 character\n"
+           "// columns, 1 blank column - ready to copy to the display in one run\n"
+           "//\n"
+           "#define ASCII_BIG_FIRST     0x20\n"
+           "#define ASCII_BIG_LAST      0x%02X\n"
+           "#define ASCII_BIG_COLS      10\n"
+           "\n"
+           "static const uint8_t ASCII_BIG_STRIP[][2][ASCII_BIG_COLS] = {\n",
+           (unsigned)(0x20 + GLYPHS - 1));
+
+    for(g = 0; g < GLYPHS; g++){
+        printf("  {");
+        for(half = 0; half < 2; half++){
+            strip[0] = 0x00;
+            for(i = 0; i < 8; i++)
+                strip[1 + i] = (uint8_t)ASCII_BIG[g][i][half];
+            strip[9] = 0x00;
+            printf("%s{", half ? ", " : "");
+            for(i = 0; i < 10; i++)
+                printf("0x%02X%s", strip[i], i < 9 ? ", " : "");
+            printf("}");
+        }
+        printf("}%s // %02X '%c'\n", g < GLYPHS - 1 ? "," : " ", 0x20 + g, 0x20 + g);
+    }
+
+    printf("};\n"
+           "\n"
+           "#endif // __MSOE_LIB_LCD_BIGFONT_H__\n");
+    return 0;
+}
+
+#endif // !__TI_COMPILER_VERSION__
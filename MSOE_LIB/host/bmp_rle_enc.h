@@ -0,0 +1,60 @@
+/*
+ * bmp_rle_enc.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     run length encoder for LCD_print_bmpRLE
+ *
+ *  Host (Linux) only - shared by host/bmp_rle_gen.c and the host tests
+ *
+ */
+#ifndef __MSOE_LIB_BMP_RLE_ENC_H__
+#define __MSOE_LIB_BMP_RLE_ENC_H__
+////////////////////////////////////////////
+//
+// Encodes a bitmap in the LCD_print_bmpRLE format (see msoe_lib_lcd.h)
+//
+//      0x00-0x7F   c+1 literal bytes follow
+//      0x80-0xFF   the next byte repeats (c & 0x7F)+2 times
+//
+// A run of 3 or more always becomes a run packet, a run of 2 only when it
+// does not split a literal packet (splitting costs a byte)
+//
+// dst must hold n + n/128 + 1 bytes - returns the encoded size
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+#define BMP_RLE_LIT_MAX     128
+#define BMP_RLE_RUN_MAX     129
+
+static uint16_t bmp_rle_encode(const uint8_t *src, uint16_t n, uint8_t *dst){
+    uint16_t out = 0;
+    uint16_t lit = 0xFFFF;      // index of the open literal header, 0xFFFF none
+    uint16_t i = 0;
+    uint16_t run;
+
+    while(i < n){
+        for(run = 1; i + run < n && run < BMP_RLE_RUN_MAX && src[i + run] == src[i]; run++)
+            ;
+        if(run >= 3 || (run == 2 && lit == 0xFFFF)){
+            dst[out++] = (uint8_t)(0x80 | (run - 2));
+            dst[out++] = src[i];
+            lit = 0xFFFF;
+            i += run;
+        }
+        else{
+            if(lit == 0xFFFF || dst[lit] == BMP_RLE_LIT_MAX - 1){
+                lit = out++;
+                dst[lit] = 0xFF;            // becomes 0 below
+            }
+            dst[lit]++;
+            dst[out++] = src[i++];
+        }
+    }
+    return out;
+}
+
+#endif // __MSOE_LIB_BMP_RLE_ENC_H__
@@ -0,0 +1,112 @@
+/*
+ * bmp_rle_gen.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     compressed bitmap headers for LCD_print_bmpRLE
+ *
+ *  Host (Linux) build step - reads a 504 byte bitmap array header (the
+ *  Bitmap_to_C.exe / pu1.h layout) and writes the run length encoded form
+ *
+ *  From MSOE_LIB:
+ *      gcc -std=c99 -I . -o bmp_rle_gen host/bmp_rle_gen.c
+ *      ./bmp_rle_gen pu1 pu1.h > pu1_rle.h
+ *
+ *  The array is named <name>_rle, the header guard __MSOE_LIB_<NAME>_RLE_H__
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "host/bmp_rle_enc.h"
+
+#define BMP_SIZE    504
+
+//
+// Values between the first '{' and the following '}'
+//
+static int read_bmp(FILE *f, uint8_t *bmp){
+    int c;
+    int n = 0;
+    char tok[16];
+    int len;
+
+    while((c = fgetc(f)) != EOF && c != '{')
+        ;
+    if(c == EOF)
+        return -1;
+    for(;;){
+        while((c = fgetc(f)) != EOF && (isspace(c) || c == ','))
+            ;
+        if(c == EOF)
+            return -1;
+        if(c == '}')
+            return n;
+        for(len = 0; c != EOF && (isalnum(c) || c == 'x' || c == 'X'); c = fgetc(f))
+            if(len < (int)sizeof(tok) - 1)
+                tok[len++] = (char)c;
+        tok[len] = 0;
+        if(len == 0 || n == BMP_SIZE)
+            return -1;
+        bmp[n++] = (uint8_t)strtoul(tok, NULL, 0);
+        if(c == '}')
+            return n;
+    }
+}
+
+int main(int argc, char **argv){
+    uint8_t bmp[BMP_SIZE];
+    uint8_t rle[BMP_SIZE + BMP_SIZE / BMP_RLE_LIT_MAX + 1];
+    uint16_t n;
+    uint16_t i;
+    char guard[64];
+    FILE *f;
+
+    if(argc != 3){
+        fprintf(stderr, "usage: %s name bitmap.h\n", argv[0]);
+        return 2;
+    }
+    if((f = fopen(argv[2], "r")) == NULL){
+        perror(argv[2]);
+        return 1;
+    }
+    if(read_bmp(f, bmp) != BMP_SIZE){
+        fprintf(stderr, "%s: expected %d bitmap bytes\n", argv[2], BMP_SIZE);
+        return 1;
+    }
+    fclose(f);
+    n = bmp_rle_encode(bmp, BMP_SIZE, rle);
+
+    for(i = 0; argv[1][i] != 0 && i < sizeof(guard) - 1; i++)
+        guard[i] = (char)toupper((unsigned char)argv[1][i]);
+    guard[i] = 0;
+
+    printf("/*\n"
+           " * %s_rle.h\n"
+           " *\n"
+           " *  Generated by host/bmp_rle_gen.c from %s - %d bytes run length encoded to %u\n"
+           " *  - do not edit, rerun the generator instead\n"
+           " *\n"
+           " */\n"
+           "#ifndef __MSOE_LIB_%s_RLE_H__\n"
+           "#define __MSOE_LIB_%s_RLE_H__\n"
+           "////////////////////////////////////\n"
+           "//\n"
+           "// %s for LCD_print_bmpRLE\n"
+           "//\n"
+           "////////////////////////////////////\n"
+           "#include <stdint.h>\n"
+           "\n"
+           "static const uint8_t %s_rle [] = {",
+           argv[1], argv[2], BMP_SIZE, (unsigned)n, guard, guard, argv[2], argv[1]);
+    for(i = 0; i < n; i++)
+        printf("%s0x%02X%s", (i % 16) ? "" : "\n  ", rle[i], i < n - 1 ? "," : "");
+    printf(" };\n"
+           "\n"
+           "#endif // __MSOE_LIB_%s_RLE_H__\n", guard);
+    return 0;
+}
+
+#endif // !__TI_COMPILER_VERSION__
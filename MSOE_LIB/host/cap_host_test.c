@@ -0,0 +1,337 @@
+/*
+ * cap_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     capture setup, periods across overflows, clock changes
+ *      Rev:    0.2     lockout - noise bursts, long and short lockouts
+ *      Rev:    0.3     CHECK, rnd and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_cap - the test plays TIMER_A1 counting
+ *  SMCLK, latches the count in CCR0 for each edge and runs the capture
+ *  interrupt, and sets the overflow flag with the overflow interrupt run
+ *  at once or after the edge (held off) - every period reported is checked
+ *  against the true time between edges. With a lockout the CCR2 compare
+ *  interrupt runs when the count gets to CCR2, and edges with the capture
+ *  interrupt off are only latched
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o cap_host_test host/cap_host_test.c msoe_lib_cap.c msoe_lib_clk.c host/msp432_host.c
+ *      ./cap_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_cap.h"
+
+void TA1_0_IRQHandler(void);
+void TA1_N_IRQHandler(void);
+
+//
+// Periods reported
+//
+static uint32_t got[64];
+static uint32_t got_n;
+
+static void capture(uint32_t period){
+    got[got_n++ & 63] = period;
+}
+
+//
+// Timer model - t is the true count in SMCLK ticks
+// Moving on sets the overflow flag for each wrap, the interrupt runs at
+// once unless held - the last wrap stays pending if it was less than
+// 0x6000 ticks ago (2ms at 12MHz - no interrupt is held off longer)
+// A CCR2 match (interrupt enabled) on the way runs the interrupt at the
+// match - a match at a wrap comes with the overflow
+//
+static uint64_t t;
+static uint32_t isr_n;                  // capture interrupts run
+
+static void run_to(uint64_t to, int hold){
+    uint64_t from = t, wrap, m;
+
+    for(;;){
+        wrap = (t | 0xFFFF) + 1;
+        m = (from & ~0xFFFFULL) | TIMER_A1->CCR[2];
+        if(m <= from)
+            m += 0x10000;
+        if((TIMER_A1->CCTL[2] & 0x0010) && m <= to && m < wrap){
+            t = m;
+            from = m;
+            TIMER_A1->R = (uint16_t)t;
+            TIMER_A1->CCTL[2] |= 0x0001;
+            TA1_N_IRQHandler();
+            continue;
+        }
+        if(wrap > to)
+            break;
+        t = wrap;
+        from = wrap - 1;
+        TIMER_A1->R = 0;
+        TIMER_A1->CTL |= 0x0001;
+        if((TIMER_A1->CCTL[2] & 0x0010) && TIMER_A1->CCR[2] == 0){
+            TIMER_A1->CCTL[2] |= 0x0001;
+            from = wrap;
+        }
+        if(!hold || (to >> 16) != (t >> 16) || (uint16_t)to >= 0x6000 || (TIMER_A1->CCTL[2] & 0x0001))
+            TA1_N_IRQHandler();
+    }
+    t = to;
+    TIMER_A1->R = (uint16_t)t;
+}
+
+static void edge(void){
+    TIMER_A1->CCR[0] = (uint16_t)t;
+    if(TIMER_A1->CCTL[0] & 0x0001)
+        TIMER_A1->CCTL[0] |= 0x0002;    // the last edge was not read
+    TIMER_A1->CCTL[0] |= 0x0001;
+    if(TIMER_A1->CCTL[0] & 0x0010){
+        isr_n++;
+        TA1_0_IRQHandler();
+    }
+}
+
+static void hw_start(uint32_t smclk){
+    host_reset();
+    Clock_SMCLK_freq = smclk;
+    t = 0;
+    got_n = 0;
+    isr_n = 0;
+    Cap_count = 0;
+    Cap_lost = 0;
+    Cap_spurious = 0;
+}
+
+static void test_init(void){
+    hw_start(5000000);
+    CHECK(Cap_Init(capture) == 1 && TIMER_A1->CTL == 0, "5MHz does not divide 12MHz");
+
+    hw_start(12000000);
+    P8->SEL0 = 0x01;
+    CHECK(Cap_Init(capture) == 0, "12MHz");
+    CHECK(TIMER_A1->CTL == (0x0200 | 0x0020 | 0x0002), "SMCLK /1, continuous, overflow interrupt");
+    CHECK(TIMER_A1->CCTL[0] == (0x8000 | 0x0800 | 0x0100 | 0x0010), "falling edge, synchronous capture, CCI0A, interrupt");
+    CHECK((P8->SEL0 & 0x01) == 0 && (P8->SEL1 & 0x01) && !(P8->DIR & 0x01), "P8.0 TA1.0 input");
+    CHECK(NVIC->ISER[0] & (1UL << 11), "TA1_N enabled (last ISER write kept)");
+}
+
+//
+// Random periods from 100us to 2s, sometimes with the overflow interrupt
+// still pending when the edge comes in (edge just after the wrap)
+//
+static void test_periods(void){
+    uint64_t last;
+    uint32_t want, i, held = 0;
+    int ok = 1;
+
+    hw_start(12000000);
+    Cap_Init(capture);
+    run_to(12345, 0);
+    edge();
+    CHECK(got_n == 0, "first edge only starts");
+    last = t;
+
+    for(i = 0; i < 20000 && ok; i++){
+        want = 1200 + rnd() % 24000000;
+        if(i % 7 == 0)                  // just after a wrap
+            want += 0x10000 - (uint16_t)(last + want) + rnd() % 0x100;
+        run_to(last + want, i & 1);
+        held += (TIMER_A1->CTL & 0x0001) != 0;
+        edge();
+        if(TIMER_A1->CTL & 0x0001)
+            TA1_N_IRQHandler();         // the held off overflow
+        if(got_n != i + 1 || got[i & 63] != want){
+            printf("  period %u: %u, want %u\n", (unsigned)i, (unsigned)got[i & 63], (unsigned)want);
+            ok = 0;
+        }
+        last = t;
+    }
+    CHECK(ok && Cap_count == 20000, "every period exact");
+    CHECK(held > 500, "edges with the overflow pending");
+
+    //
+    // Edge just before the wrap, overflow flagged before the interrupt
+    // ran - the capture goes with the old count
+    //
+    run_to((last | 0xFFFF) - 10, 0);
+    want = (uint32_t)(t - last);
+    TIMER_A1->CCR[0] = (uint16_t)t;
+    TIMER_A1->CCTL[0] |= 0x0001;
+    run_to(t + 40, 1);
+    TA1_0_IRQHandler();
+    TA1_N_IRQHandler();
+    CHECK(got[(got_n - 1) & 63] == want, "edge before the pending overflow");
+}
+
+static void test_gaps(void){
+    uint32_t n;
+
+    hw_start(12000000);
+    Cap_Init(capture);
+    edge();
+    run_to(t + 100000, 0);
+    edge();
+    CHECK(got_n == 1 && got[0] == 100000, "period");
+
+    //
+    // Two edges before the interrupt - the period covers both, dropped
+    //
+    run_to(t + 50000, 0);
+    TIMER_A1->CCTL[0] |= 0x0001;
+    run_to(t + 50000, 0);
+    edge();
+    CHECK(got_n == 1 && Cap_lost == 1, "lost edge - not reported");
+    run_to(t + 70000, 0);
+    edge();
+    CHECK(got_n == 2 && got[1] == 70000, "next period good");
+
+    //
+    // Stopped - more than CAP_SPAN_MAX overflows
+    //
+    run_to(t + (uint64_t)CAP_SPAN_MAX * 0x10000 + 1, 0);
+    edge();
+    CHECK(got_n == 2, "stopped - edge only starts");
+    run_to(t + (uint64_t)(CAP_SPAN_MAX - 1) * 0x10000, 0);
+    edge();
+    n = (uint32_t)(CAP_SPAN_MAX - 1) * 0x10000;
+    CHECK(got_n == 3 && got[2] == n, "longest period");
+}
+
+//
+// Clock_48MHz_Divide - SMCLK 6MHz, each tick is 2 of 12MHz
+//
+static void test_clock(void){
+    hw_start(12000000);
+    CS->STAT = 0x0F020004;
+    Clock_MCLK_freq = 48000000;
+    Cap_Init(capture);
+    edge();
+    run_to(t + 30000, 0);
+    edge();
+    CHECK(Clock_48MHz_Divide(2) == 0 && Clock_SMCLK_freq == 6000000, "divided");
+    run_to(t + 20000, 0);
+    edge();
+    CHECK(got_n == 1, "period across the change dropped");
+    run_to(t + 20000, 0);
+    edge();
+    CHECK(got_n == 2 && got[1] == 40000, "6MHz ticks in 12MHz units");
+    CHECK(Clock_48MHz_Divide(4) == 0, "divided again");
+    run_to(t + 1000, 0);
+    edge();
+    run_to(t + 1000, 0);
+    edge();
+    CHECK(got_n == 3 && got[2] == 4000, "3MHz ticks in 12MHz units");
+    Clock_48MHz_Divide(1);
+}
+
+//
+// Lockout - real edges with noise bursts after them, the noise must cost
+// no interrupts and no periods
+//
+static void test_lockout(void){
+    uint64_t last, pos;
+    uint32_t want, i, k, burst, noise = 0;
+    int ok = 1;
+
+    hw_start(12000000);
+    Cap_Init(capture);
+    CHECK(Cap_lockout(CAP_LOCK_MAX + 1) == 1, "too long");
+    CHECK(Cap_lockout(CAP_RPM_TICKS(12000)) == 0, "12000 RPM - 5ms");
+    run_to(1000, 0);
+    edge();
+    CHECK((TIMER_A1->CCTL[0] & 0x0010) == 0 && (TIMER_A1->CCTL[2] & 0x0010), "capture off, compare on");
+    CHECK(TIMER_A1->CCR[2] == (uint16_t)(1000 + 60000), "compare at the end");
+    last = t;
+
+    for(i = 0; i < 5000 && ok; i++){
+        want = 60000 + rnd() % 2000000;
+        if(i % 5 == 0)                  // just after a wrap
+            want += 0x10000 - (uint16_t)(last + want) + rnd() % 0x100;
+        burst = rnd() % 4 ? rnd() % 30 : 0;
+        for(k = 0, pos = last; k < burst; k++){ // bouncing edge, then reflections up to the end
+            pos += k < burst / 2 ? 40 : 1 + rnd() % (59000 / burst);
+            run_to(pos, 0);
+            edge();
+        }
+        noise += burst != 0;
+        run_to(last + want, i & 1);
+        edge();
+        if(TIMER_A1->CTL & 0x0001)
+            TA1_N_IRQHandler();
+        if(got_n != i + 1 || got[i & 63] != want){
+            printf("  lockout period %u: %u, want %u\n", (unsigned)i, (unsigned)got[i & 63], (unsigned)want);
+            ok = 0;
+        }
+        last = t;
+    }
+    CHECK(ok && Cap_count == 5000, "noise - every period exact");
+    CHECK(isr_n == 5001, "one capture interrupt per real edge");
+    CHECK(Cap_spurious >= noise && Cap_spurious <= 2 * noise, "spurious lockouts counted");
+    CHECK(Cap_lost == 0, "no lost edges");
+
+    //
+    // 10000 RPM - longer than a wrap, the first match is not the end
+    //
+    hw_start(12000000);
+    Cap_Init(capture);
+    Cap_lockout(CAP_RPM_TICKS(10000));
+    edge();
+    last = t;
+    run_to(last + 71999, 0);
+    edge();
+    CHECK(got_n == 0 && Cap_spurious == 0 && (TIMER_A1->CCTL[0] & 0x0010) == 0, "still locked after the first match");
+    run_to(last + 72000, 0);
+    CHECK(Cap_spurious == 1 && (TIMER_A1->CCTL[0] & 0x0010) && TIMER_A1->CCTL[2] == 0, "re-armed at the end");
+    run_to(last + 72001, 0);
+    edge();
+    CHECK(got_n == 1 && got[0] == 72001, "edge just after the end");
+
+    //
+    // Short lockout, capture interrupt late - over before it is set up
+    //
+    Cap_lockout(100);
+    run_to(t + 5000, 0);
+    last = t;
+    TIMER_A1->CCR[0] = (uint16_t)t;
+    TIMER_A1->CCTL[0] |= 0x0001;
+    run_to(t + 150, 0);
+    TA1_0_IRQHandler();
+    CHECK(got_n == 2 && got[1] == 5000, "late interrupt");
+    CHECK((TIMER_A1->CCTL[0] & 0x0010) && TIMER_A1->CCTL[2] == 0, "over already - re-armed");
+    run_to(t + 10, 0);
+    edge();
+    CHECK(got_n == 3 && got[2] == 160, "next edge taken");
+
+    //
+    // Clock change in a lockout - re-armed, lockout in the new ticks
+    //
+    hw_start(12000000);
+    CS->STAT = 0x0F020004;
+    Clock_MCLK_freq = 48000000;
+    Cap_Init(capture);
+    Cap_lockout(60000);
+    edge();
+    run_to(t + 1000, 0);
+    CHECK(Clock_48MHz_Divide(2) == 0 && (TIMER_A1->CCTL[0] & 0x0010), "clock change - re-armed");
+    edge();
+    CHECK(TIMER_A1->CCR[2] == (uint16_t)(t + 30000), "6MHz - 30000 tick lockout");
+    Clock_48MHz_Divide(1);
+    Cap_lockout(0);
+}
+
+int main(void){
+    rnd_seed(7);
+    test_init();
+    test_periods();
+    test_gaps();
+    test_clock();
+    test_lockout();
+
+    return host_test_end("cap_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,183 @@
+/*
+ * clk_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     boot profile and fast start
+ *      Rev:    0.2     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of the msoe_lib_clk boot profile and the fast start
+ *  The test plays the PCM and CS status between coroutine calls, counts
+ *  DWT cycles per register access, and plays the CS interrupt
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o clk_host_test host/clk_host_test.c msoe_lib_clk.c host/msp432_host.c
+ *      ./clk_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <string.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_clk.h"
+
+void CS_IRQHandler(void);
+
+//
+// 10 cycles per DWT access
+//
+static uint32_t cycles;
+static uint32_t dwt_count(void){
+    return cycles += 10;
+}
+
+//
+// Status checks that fail before each wait is done
+//
+static uint32_t pmr_busy, vcore, hfxt, stat;
+
+static void hw_start(uint32_t p, uint32_t v, uint32_t h, uint32_t s){
+    host_reset();
+    host_dwt_clock = dwt_count;
+    cycles = 0;
+    pmr_busy = p;
+    vcore = v;
+    hfxt = h;
+    stat = s;
+    PCM->CTL1 = pmr_busy ? 0x00000100 : 0;
+    CS->IFG = hfxt ? 0x00000002 : 0;
+    CS->STAT = stat ? 0 : 0x0F020004;
+}
+
+//
+// After a call - the status the coroutine stopped on moves on by one check
+// (1000 cycles pass)
+//
+static void hw_step(void){
+    cycles += 1000;
+    if(PCM->CTL1 & 0x00000100){
+        if(--pmr_busy == 0)
+            PCM->CTL1 = 0;
+    }
+    else if((PCM->CTL0 & 0x0000000F) == 1 && (PCM->CTL0 & 0x00003F00) != 0x00000100){
+        if(vcore == 0 || --vcore == 0)
+            PCM->CTL0 |= 0x00000100;
+    }
+    else if(CS->IFG & 0x00000002){
+        if(--hfxt == 0)
+            CS->IFG &= ~0x00000002;
+    }
+    else if(CS->CTL1 != 0 && stat){
+        if(--stat == 0)
+            CS->STAT = 0x0F020004;
+    }
+}
+
+static int run(void){
+    Pt_t pt;
+    int result;
+
+    PT_INIT(&pt);
+    while(PT_SCHEDULE(Clock_Init_48MHz_pt(&pt, &result)))
+        hw_step();
+    return result;
+}
+
+static void test_profile(void){
+    Clock_boot_t first;
+    uint32_t i;
+    int ok = 1;
+
+    Clock_boot[0].magic = 0;            // power up - RAM content unknown
+    hw_start(3, 5, 20, 2);
+    CHECK(run() == 0, "bring-up");
+    CHECK(Clock_boot[0].boots == 1 && Clock_boot[0].result == 0, "first boot");
+    CHECK(Clock_boot[0].pmr_checks == 3 && Clock_boot[0].vcore_checks == 5
+          && Clock_boot[0].hfxt_checks == 20 && Clock_boot[0].clk_checks == 2, "checks per wait");
+    for(i = 1; i < CLOCK_BOOT_PHASES; i++)
+        ok &= Clock_boot[0].cycles[i] > Clock_boot[0].cycles[i - 1];
+    CHECK(ok && Clock_boot[0].cycles[CLOCK_BOOT_PCM] >= (3 + 5) * 1000, "phases in order");
+    CHECK(Clock_boot[0].cycles[CLOCK_BOOT_HFXT] - Clock_boot[0].cycles[CLOCK_BOOT_FLASH] >= 20 * 1000
+          && Clock_boot[0].cycles[CLOCK_BOOT_HFXT] - Clock_boot[0].cycles[CLOCK_BOOT_FLASH] < 21 * 1000,
+          "crystal start time");
+    CHECK((CoreDebug->DEMCR & 0x01000000) && (DWT->CTRL & 1), "cycle counter left running");
+    printf("  profile      pcm %u flash %u hfxt %u ready %u cycles\n",
+           (unsigned)Clock_boot[0].cycles[0], (unsigned)Clock_boot[0].cycles[1],
+           (unsigned)Clock_boot[0].cycles[2], (unsigned)Clock_boot[0].cycles[3]);
+
+    //
+    // Reset - the record is kept and moves down
+    //
+    first = Clock_boot[0];
+    hw_start(0, 0, 1, 0);
+    CHECK(run() == 0, "second bring-up");
+    CHECK(Clock_boot[0].boots == 2 && memcmp(&Clock_boot[1], &first, sizeof(first)) == 0,
+          "previous boot kept");
+    CHECK(Clock_boot[0].hfxt_checks == 1 && Clock_boot[0].pmr_checks == 0, "this boot's checks");
+
+    hw_start(100001, 0, 0, 0);
+    CHECK(run() == 1, "PCM timeout");
+    CHECK(Clock_boot[0].boots == 3 && Clock_boot[0].result == 1 && Clock_boot[0].pmr_checks == 100000,
+          "failure recorded");
+    CHECK(Clock_boot[0].cycles[CLOCK_BOOT_PCM] == 0 && Clock_boot[0].cycles[CLOCK_BOOT_READY] == 0,
+          "steps not reached are 0");
+
+    Clock_boot[0].magic = 0x12345678;   // power loss
+    hw_start(0, 0, 0, 0);
+    run();
+    CHECK(Clock_boot[0].boots == 1 && Clock_boot[1].boots == 0, "new record after power up");
+}
+
+static void test_fast(void){
+    uint32_t i;
+
+    //
+    // Crystal starting - runs from the DCO, the interrupt switches
+    //
+    hw_start(1, 1, 3, 0);
+    PCM->CTL1 = 0;
+    PCM->CTL0 = 0x00000100;
+    CHECK(Clock_Init_48MHz_fast() == 0, "fast start");
+    CHECK(CS->CTL1 == 0x00001233 && CS->CTL0 == 0x00030000, "MCLK from the DCO at 12MHz");
+    CHECK(Clock_MCLK_freq == 12000000 && Clock_SMCLK_freq == 12000000
+          && Clock_MCLK_per_us == 12UL << CLOCK_PER_US_SHIFT, "12MHz published");
+    CHECK((CS->IE & 0x00000200) && (NVIC->ISER[0] & 0x2) && CS->KEY == 0, "start counter interrupt on");
+    CHECK((FLCTL->BANK0_RDCTL & 0xF000) == 0x1000, "flash wait state before the switch");
+    CHECK(Clock_boot[0].result == -1, "bring-up not finished");
+
+    for(i = 0; i < 2; i++){             // the crystal faults again
+        CS->CTL3 = 0;
+        CS_IRQHandler();
+        CHECK(CS->CTL1 == 0x00001233 && (CS->CTL3 & 0x00000040) && CS->KEY == 0, "fault - stay on the DCO, count again");
+    }
+    CS->IFG = 0;
+    CS_IRQHandler();
+    CHECK(CS->CTL1 == 0x20101255 && Clock_MCLK_freq == 48000000 && Clock_SMCLK_freq == 12000000,
+          "switched to HFXT");
+    CHECK(!(CS->IE & 0x00000200) && CS->KEY == 0, "interrupt off, key closed");
+    CHECK(Clock_boot[0].result == 0 && Clock_boot[0].hfxt_checks == 3, "bring-up finished");
+
+    //
+    // Crystal already stable - no DCO step
+    //
+    hw_start(0, 0, 0, 0);
+    PCM->CTL0 = 0x00000100;
+    CHECK(Clock_Init_48MHz_fast() == 0 && CS->CTL1 == 0x20101255 && CS->IE == 0, "stable crystal - straight to HFXT");
+
+    //
+    // PCM failure - nothing changed
+    //
+    hw_start(100001, 0, 1, 0);
+    Clock_MCLK_freq = 3000000;
+    CHECK(Clock_Init_48MHz_fast() == 1 && Clock_MCLK_freq == 3000000 && CS->IE == 0, "PCM failure");
+}
+
+int main(void){
+    test_profile();
+    test_fast();
+
+    return host_test_end("clk_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
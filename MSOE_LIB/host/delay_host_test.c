@@ -0,0 +1,251 @@
+/*
+ * delay_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     low power delays - timer chaining, sleep mode and accounting
+ *      Rev:    0.2     SysTick delays at the published MCLK, chained reloads
+ *      Rev:    0.3     out of range input reported to msoe_lib_err
+ *      Rev:    0.4     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_delay
+ *      low power delays - __WFI() plays the TIMER_A3 compare interrupt (and
+ *      now and then an unrelated interrupt)
+ *      SysTick delays - the host SysTick counts one clock per register access,
+ *      the clocks spent are compared with the clocks asked for
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o delay_host_test host/delay_host_test.c msoe_lib_delay.c msoe_lib_clk.c msoe_lib_err.c host/msp432_host.c
+ *      ./delay_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <string.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_delay.h"
+
+void TA3_0_IRQHandler(void);
+
+//
+// Simulated sleep - each WFI runs TIMER_A3 up to CCR0 and takes its interrupt,
+// except every 5th which is woken by some other interrupt
+//
+static uint64_t slept_counts;           // timer counts slept
+static uint32_t wfi_calls;
+static uint32_t wfi_bad_mode;           // WFI with the wrong sleep mode
+static uint16_t expect_tassel;
+static uint32_t expect_deep;
+
+static void wfi(void){
+    Timer_A_Type *ta = TIMER_A3;
+    wfi_calls++;
+    if((ta->CTL & 0x0300) != expect_tassel || (ta->CTL & 0x0030) != 0x0010
+       || !(ta->CCTL[0] & 0x0010)
+       || ((SCB->SCR & 0x0004) != 0) != expect_deep
+       || (expect_deep && (PCM->CTL0 & 0x00F0) != 0))
+        wfi_bad_mode++;
+    if(wfi_calls % 5 == 0)
+        return;                         // another interrupt woke the CPU
+    slept_counts += (uint32_t)ta->CCR[0] + 1;
+    ta->CCTL[0] |= 0x0001;              // CCIFG
+    TA3_0_IRQHandler();
+}
+
+static void check_sleep(uint64_t expect_counts, const char *msg){
+    CHECK(slept_counts == expect_counts, msg);
+    CHECK(wfi_bad_mode == 0, "timer clock and sleep mode");
+    CHECK((SCB->SCR & 0x0004) == 0, "SLEEPDEEP cleared after the delay");
+    CHECK(TIMER_A3->CTL == 0 && TIMER_A3->CCTL[0] == 0, "timer stopped after the delay");
+    slept_counts = 0;
+    wfi_bad_mode = 0;
+}
+
+static void test_lpm3(void){
+    static const uint32_t ms[] = {0, 1, 2, 30, 125, 999, 1000, 2000, 2001, 65535, 123457, 131071999};
+    Delay_stats_t st;
+    uint32_t i;
+    uint32_t total = 0;
+
+    expect_tassel = 0x0100;             // ACLK
+    expect_deep = 1;
+    for(i = 0; i < sizeof(ms) / sizeof(ms[0]); i++){
+        Delay_LPM3_ms(ms[i]);
+        check_sleep((uint64_t)ms[i] * 32768 / 1000, "LPM3 ms counts = floor(ms x 32.768)");
+        total += ms[i];
+    }
+    Delay_LPM3_sec(3);
+    check_sleep(3 * 32768, "LPM3 sec counts");
+    Delay_LPM3_sec(131071);
+    check_sleep((uint64_t)131071 * 32768, "LPM3 longest delay");
+    total += 3000 + 131071000;
+
+    Delay_sleep_stats(&st);
+    CHECK(st.sleep_ms == total, "LPM3 sleep time accounted");
+    CHECK(st.sleeps == sizeof(ms) / sizeof(ms[0]) - 1 + 2, "LPM3 delays counted (0ms does not sleep)");
+    CHECK(st.wakeups == wfi_calls, "every wake up counted");
+}
+
+static void test_lpm0(void){
+    Delay_stats_t st;
+    uint32_t i;
+
+    Delay_sleep_stats_clear();
+    wfi_calls = 0;
+    expect_tassel = 0x0200;             // SMCLK
+    expect_deep = 0;
+    Delay_LPM0_us(10, 12000000);
+    check_sleep(120, "LPM0 10us at 12MHz");
+    Delay_LPM0_us(100000, 12000000);
+    check_sleep(1200000, "LPM0 100ms chained at 12MHz");
+    Delay_LPM0_us(357913941, 12000000);
+    check_sleep((uint64_t)357913941 * 12, "LPM0 longest delay at 12MHz");
+    Delay_LPM0_us(7, 3000000);
+    check_sleep(21, "LPM0 at 3MHz");
+    for(i = 0; i < 2000; i++)           // 2000 x 999us
+        Delay_LPM0_us(999, 12000000);
+    check_sleep((uint64_t)2000 * 999 * 12, "LPM0 repeated");
+
+    Delay_sleep_stats(&st);
+    CHECK(st.sleep_ms == (10 + 100000 + 357913941 + 7 + 2000 * 999) / 1000, "LPM0 sleep time with us carry");
+    CHECK(st.sleeps == 2004, "LPM0 delays counted");
+    CHECK(st.wakeups == wfi_calls, "every wake up counted");
+    Delay_sleep_stats_clear();
+    Delay_sleep_stats(&st);
+    CHECK(st.sleep_ms == 0 && st.sleeps == 0 && st.wakeups == 0, "stats cleared");
+}
+
+//
+// SysTick clocks spent by a delay - each reload of up to 2^24 clocks costs
+// a couple of extra register accesses in the model
+//
+static uint64_t systick_start;
+
+static void spin_start(void){
+    systick_start = host_systick_clocks;
+}
+
+static int spin_took(uint64_t expect){
+    uint64_t took = host_systick_clocks - systick_start;
+    uint64_t slack = 4 * (expect / 0x01000000 + 1);
+    if(took + slack < expect || took > expect + slack){
+        printf("  %llu clocks, expected %llu\n",
+               (unsigned long long)took, (unsigned long long)expect);
+        return 0;
+    }
+    return 1;
+}
+
+static void test_mclk(void){
+    static const uint8_t div[] = {1, 2, 4, 8, 16, 32, 64, 128};
+    static const uint8_t hs_shift[] = {1, 2, 3, 4, 5, 6, 7, 7};
+    static const uint8_t sm_shift[] = {2, 3, 4, 5, 6, 7, 7, 7};
+    uint32_t i;
+    uint32_t mclk;
+    int ok = 1;
+
+    CHECK(Clock_MCLK_freq == 3000000 && Clock_SMCLK_freq == 3000000, "reset clocks are the 3MHz DCO");
+    spin_start();
+    Delay_MCLK_ms(10);
+    CHECK(spin_took(30000), "10ms at the reset 3MHz");
+
+    host_pcm.CTL0 = 0x00000100;         // AM_LDO_VCORE1
+    host_cs.STAT = 0x0F020004;          // clocks ready
+    CHECK(Clock_Init_48MHz() == 0, "Clock_Init_48MHz");
+    CHECK(Clock_MCLK_freq == 48000000 && Clock_HSMCLK_freq == 24000000
+          && Clock_SMCLK_freq == 12000000, "48MHz clocks published");
+    CHECK(Clock_MCLK_per_us == 48UL << CLOCK_PER_US_SHIFT, "48 cycles per us");
+
+    spin_start();
+    Delay_MCLK_us(1000);
+    CHECK(spin_took(48000), "1ms in us at 48MHz");
+    spin_start();
+    Delay_MCLK_ms(500);
+    CHECK(spin_took(24000000), "500ms at 48MHz - 2 reloads");
+    spin_start();
+    Delay_MCLK_sec(1);
+    CHECK(spin_took(48000000), "1s at 48MHz - 3 reloads");
+    spin_start();
+    Delay_48MHz_us(349524);
+    CHECK(spin_took(349524UL * 48), "Delay_48MHz_us longest");
+
+    spin_start();
+    Delay_us(349526, 48000000);
+    CHECK(spin_took(349526UL * 48), "Delay_us past 24 bits");
+    spin_start();
+    Delay_ms(3, 47999999);
+    CHECK(spin_took(143999), "Delay_ms integer count");
+    spin_start();
+    Delay_sec(1, 36000000);
+    CHECK(spin_took(36000000), "Delay_sec past 24 bits");
+
+    for(i = 0; i < sizeof(div); i++){
+        ok &= Clock_48MHz_Divide(div[i]) == 0;
+        mclk = 48000000UL / div[i];
+        ok &= Clock_MCLK_freq == mclk;
+        ok &= Clock_HSMCLK_freq == 48000000UL >> hs_shift[i];
+        ok &= Clock_SMCLK_freq == 48000000UL >> sm_shift[i];
+        spin_start();
+        Delay_MCLK_us(1000);
+        ok &= spin_took(mclk / 1000);
+        spin_start();
+        Delay_MCLK_ms(250);
+        ok &= spin_took(mclk / 4);
+        spin_start();
+        Delay_48MHz_ms(20);
+        ok &= spin_took(mclk / 50);
+        spin_start();
+        Delay_MCLK_us(3);
+        ok &= spin_took(3UL * mclk / 1000000);
+    }
+    CHECK(ok, "delays follow Clock_48MHz_Divide");
+    CHECK(Clock_MCLK_per_us == 24576, "375KHz is 0.375 cycles per us");
+    Clock_48MHz_Divide(3);
+    CHECK(Clock_MCLK_freq == 48000000, "bad divider - 48MHz published");
+}
+
+//
+// Out of range input - reported, no delay, returns 1
+// (variables - a constant out of range would not compile)
+//
+static void test_range(void){
+    volatile uint32_t big = 349525;
+    volatile uint32_t small = 32;
+    Err_t e;
+    uint32_t wfi_before = wfi_calls;
+
+    Err_clear();
+    spin_start();
+    CHECK(Delay_48MHz_us(big) == 1, "Delay_48MHz_us too long");
+    CHECK(Delay_3MHz_us(small) == 1, "Delay_3MHz_us too short");
+    big = 22;
+    CHECK(Delay_48MHz_sec(big) == 1, "Delay_48MHz_sec too long");
+    big = 131072;
+    CHECK(Delay_LPM3_sec(big) == 1, "Delay_LPM3_sec too long");
+    big = 1;
+    CHECK(Delay_LPM0_us(big, 999999) == 1, "Delay_LPM0_us SMCLK below 1MHz");
+    CHECK(spin_took(0) && wfi_calls == wfi_before, "no delay");
+
+    CHECK(Err_pending() == 5, "each reported");
+    CHECK(Err_get(&e) && e.code == ERR_DELAY_48MHZ_US && e.arg == 349525, "48MHz us report");
+    CHECK(Err_get(&e) && e.code == ERR_DELAY_3MHZ_US && e.arg == 32, "3MHz us report");
+    CHECK(Err_get(&e) && e.code == ERR_DELAY_48MHZ_SEC && e.arg == 22, "48MHz sec report");
+    CHECK(Err_get(&e) && e.code == ERR_DELAY_LPM3_SEC && e.arg == 131072, "LPM3 sec report");
+    CHECK(Err_get(&e) && e.code == ERR_DELAY_LPM0_US && e.arg == 1, "LPM0 us report");
+    CHECK(Delay_48MHz_us(349524) == 0 && Err_pending() == 0, "in range is not reported");
+}
+
+int main(void){
+    host_reset();
+    host_wfi_hook = wfi;
+    test_lpm3();
+    test_lpm0();
+    test_mclk();
+    test_range();
+
+    return host_test_end("delay_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,89 @@
+/*
+ * err_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     error ring, overflow, hook
+ *      Rev:    0.2     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_err
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o err_host_test host/err_host_test.c msoe_lib_err.c
+ *      ./err_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_err.h"
+
+static uint32_t hook_calls;
+static uint16_t hook_code;
+static uint32_t hook_arg;
+
+static void hook(uint16_t code, uint32_t arg){
+    hook_calls++;
+    hook_code = code;
+    hook_arg = arg;
+}
+
+static void test_ring(void){
+    Err_t e;
+    uint32_t i;
+    int ok = 1;
+
+    CHECK(Err_pending() == 0 && Err_get(&e) == 0, "empty at start");
+    Err_report(0x0201, 7);
+    Err_report(0x0202, 8);
+    CHECK(Err_pending() == 2, "two pending");
+    CHECK(Err_get(&e) == 1 && e.code == 0x0201 && e.arg == 7, "oldest first");
+    CHECK(Err_get(&e) == 1 && e.code == 0x0202 && e.arg == 8, "then the next");
+    CHECK(Err_get(&e) == 0, "empty again");
+
+    // more than the ring holds - the newest ERR_RING stay
+    for(i = 0; i < ERR_RING + 3; i++)
+        Err_report(0x0300, i);
+    CHECK(Err_pending() == ERR_RING, "ring full");
+    CHECK(Err_lost() == 3, "oldest dropped and counted");
+    for(i = 3; i < ERR_RING + 3; i++)
+        ok &= Err_get(&e) == 1 && e.arg == i;
+    CHECK(ok, "newest reports kept in order");
+
+    // head / tail wrap many times
+    ok = 1;
+    for(i = 0; i < 1000; i++){
+        Err_report(0x0400, i);
+        if(i % 3 == 0)
+            Err_report(0x0401, i);
+        ok &= Err_get(&e) == 1 && e.code == 0x0400 && e.arg == i;
+        if(i % 3 == 0)
+            ok &= Err_get(&e) == 1 && e.code == 0x0401 && e.arg == i;
+    }
+    CHECK(ok && Err_pending() == 0, "free running indexes wrap");
+
+    Err_report(1, 1);
+    Err_clear();
+    CHECK(Err_pending() == 0 && Err_lost() == 0, "cleared");
+}
+
+static void test_hook(void){
+    Err_set_hook(hook);
+    Err_report(ERR_DELAY_LPM3_MS, 200000000);
+    CHECK(hook_calls == 1 && hook_code == ERR_DELAY_LPM3_MS && hook_arg == 200000000, "hook called");
+    CHECK(Err_pending() == 1, "hooked report still queued");
+    Err_set_hook(0);
+    Err_report(ERR_DELAY_LPM3_MS, 1);
+    CHECK(hook_calls == 1, "hook removed");
+    Err_clear();
+}
+
+int main(void){
+    test_ring();
+    test_hook();
+
+    return host_test_end("err_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,337 @@
+/*
+ * filt_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     filters against brute force, replayed period traces
+ *      Rev:    0.2     CHECK, rnd and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_filt - each filter (running sums and
+ *  sorting network) must give what the plain sum, sort or float formula
+ *  over the whole history gives, and period traces of the IR rig (a
+ *  steady speed, a run up and coast down, a stop) are replayed through the
+ *  filter and Speed_tenths - split and doubled periods must not move the
+ *  reading
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -O2 -I host -I . -o filt_host_test host/filt_host_test.c msoe_lib_filt.c msoe_lib_speed.c -lm
+ *      ./filt_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "host_test.h"
+#include "msoe_lib_filt.h"
+#include "msoe_lib_speed.h"
+
+static int cmp(const void *a, const void *b){
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static int init(Filt_t *f, uint8_t mode, uint8_t avg_len, uint8_t ema_shift){
+    Filt_cfg_t cfg;
+
+    cfg.mode = mode;
+    cfg.avg_len = avg_len;
+    cfg.ema_shift = ema_shift;
+    return Filt_Init(f, &cfg);
+}
+
+static void test_config(void){
+    Filt_t f;
+
+    CHECK(init(&f, FILT_AVG | FILT_EMA, 4, 2) == 1, "average and EMA");
+    CHECK(init(&f, FILT_AVG, 0, 0) == 1, "length 0");
+    CHECK(init(&f, FILT_AVG, 6, 0) == 1, "length not a power of 2");
+    CHECK(init(&f, FILT_AVG, FILT_AVG_MAX * 2, 0) == 1, "too long");
+    CHECK(init(&f, FILT_EMA, 0, 0) == 1, "shift 0");
+    CHECK(init(&f, FILT_EMA, 0, FILT_EMA_SHIFT_MAX + 1) == 1, "shift too big");
+    CHECK(init(&f, FILT_MEDIAN | FILT_AVG, FILT_AVG_MAX, 0) == 0, "longest average");
+    CHECK(init(&f, FILT_MEDIAN | FILT_EMA, 0, FILT_EMA_SHIFT_MAX) == 0, "slowest EMA");
+    CHECK(init(&f, 0, 0, 0) == 0 && Filt_add(&f, 1234) == 1234, "no stages - passed through");
+    CHECK(f.out == 1234, "output kept");
+}
+
+//
+// Random samples over the whole 32 bit range (and small ones) against the
+// history kept in full - the first sample fills it
+//
+static uint32_t hist[100000];
+
+static uint32_t sample(void){
+    uint32_t r = rnd();
+
+    if(r & 1)
+        return 0xFFFFFFFFUL - (rnd() & 0xFFFF);
+    if(r & 2)
+        return rnd() & 0xFF;
+    return (rnd() << 8) ^ rnd();
+}
+
+static uint32_t past(uint32_t i, uint32_t back){
+    return back > i ? hist[0] : hist[i - back];
+}
+
+static void test_reference(void){
+    static const uint8_t lens[] = {1, 2, 4, 8, 16};
+    Filt_t f;
+    uint32_t i, k, m[5], n = sizeof(hist) / sizeof(hist[0]);
+    uint32_t bad;
+    uint64_t sum;
+    double ema;
+
+    // median
+    init(&f, FILT_MEDIAN, 0, 0);
+    for(i = 0, bad = 0; i < n; i++){
+        hist[i] = sample();
+        for(k = 0; k < 5; k++)
+            m[k] = past(i, k);
+        qsort(m, 5, sizeof(m[0]), cmp);
+        bad += Filt_add(&f, hist[i]) != m[2];
+    }
+    CHECK(bad == 0, "median of the last 5");
+
+    // average - every length
+    for(k = 0; k < sizeof(lens); k++){
+        init(&f, FILT_AVG, lens[k], 0);
+        for(i = 0, bad = 0; i < n; i++){
+            uint32_t j;
+
+            hist[i] = sample();
+            for(j = 0, sum = 0; j < lens[k]; j++)
+                sum += past(i, j);
+            bad += Filt_add(&f, hist[i]) != (uint32_t)((sum + lens[k] / 2) / lens[k]);
+        }
+        CHECK(bad == 0, "rounded mean of the last avg_len");
+    }
+
+    // median then average - the average of the medians
+    init(&f, FILT_MEDIAN | FILT_AVG, 8, 0);
+    {
+        static uint32_t med[100000];
+        uint32_t j;
+
+        for(i = 0, bad = 0; i < n; i++){
+            hist[i] = sample();
+            for(j = 0; j < 5; j++)
+                m[j] = past(i, j);
+            qsort(m, 5, sizeof(m[0]), cmp);
+            med[i] = m[2];
+            for(j = 0, sum = 0; j < 8; j++)
+                sum += j > i ? med[0] : med[i - j];
+            bad += Filt_add(&f, hist[i]) != (uint32_t)((sum + 4) / 8);
+        }
+        CHECK(bad == 0, "median then mean");
+    }
+
+    // EMA - every shift, within 1 of the float recurrence
+    for(k = 1; k <= FILT_EMA_SHIFT_MAX; k++){
+        double w = 1.0 / (1 << k), worst = 0;
+
+        init(&f, FILT_EMA, 0, k);
+        for(i = 0, bad = 0; i < n; i++){
+            hist[i] = sample();
+            ema = i ? ema + (hist[i] - ema) * w : hist[i];
+            if(fabs(Filt_add(&f, hist[i]) - ema) > worst)
+                worst = fabs(f.out - ema);
+        }
+        if(worst >= 1.0)
+            printf("  ema shift %u: off by %.3f\n", (unsigned)k, worst);
+        CHECK(worst < 1.0, "EMA within 1");
+    }
+
+    // reset - the next sample starts again
+    init(&f, FILT_MEDIAN | FILT_AVG, 4, 0);
+    Filt_add(&f, 1000);
+    Filt_add(&f, 2000);
+    Filt_reset(&f);
+    CHECK(f.out == 0 && f.n == 0, "reset - no output");
+    CHECK(Filt_add(&f, 5000) == 5000 && Filt_add(&f, 5000) == 5000, "history refilled");
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Replayed traces
+//
+////////////////////////////////////////////////////////////////////
+//
+// Rig traces - the periods the capture reports for a speed profile, with
+// 0.4% revolution to revolution jitter, and every 7 to 12 revolutions a
+// glitch
+//      split   - a reflection makes a second edge part way round, one
+//                period comes in as two short ones
+//      doubled - a missed pulse, two periods come in as one
+//      late    - one edge late (a dirty mark), a long period then a
+//                short one
+//
+#define TRACE_MAX   4096
+
+typedef struct {
+    uint32_t period[TRACE_MAX];     // as reported
+    uint32_t truth[TRACE_MAX];      // true speed (tenths) at that time
+    uint8_t glitch[TRACE_MAX];      // 1 a short or long period
+    uint32_t n;
+} Trace_t;
+
+static Trace_t trace;
+
+static uint32_t period_of(double tenths){
+    return (uint32_t)(36000.0 * SPEED_TICK_HZ / (SPEED_REV_PER_MI * tenths) + 0.5);
+}
+
+static void put(uint32_t p, uint32_t truth, uint8_t glitch){
+    if(trace.n < TRACE_MAX){
+        trace.period[trace.n] = p;
+        trace.truth[trace.n] = truth;
+        trace.glitch[trace.n] = glitch;
+        trace.n++;
+    }
+}
+
+//
+// speed(i) - tenths of mph at revolution i (0 to stop)
+//
+static void record(double (*speed)(uint32_t), uint32_t revs){
+    uint32_t i, next = 9, p, q, a;
+    double s;
+
+    trace.n = 0;
+    for(i = 0; i < revs; i++){
+        s = speed(i);
+        p = period_of(s * (1.0 + ((int32_t)(rnd() % 801) - 400) / 100000.0));
+        if(i != next){
+            put(p, (uint32_t)(s + 0.5), 0);
+            continue;
+        }
+        next = i + 7 + rnd() % 6;
+        switch(rnd() % 3){
+            case 0:                             // split
+                a = p / 8 + rnd() % (p * 3 / 4);
+                put(a, (uint32_t)(s + 0.5), 1);
+                put(p - a, (uint32_t)(s + 0.5), 1);
+                break;
+            case 1:                             // doubled
+                q = period_of(speed(++i));
+                put(p + q, (uint32_t)(s + 0.5), 1);
+                break;
+            default:                            // late edge
+                q = period_of(speed(++i));
+                a = p / 4 + rnd() % (p / 2);
+                put(p + a, (uint32_t)(s + 0.5), 1);
+                put(q - a, (uint32_t)(s + 0.5), 1);
+                break;
+        }
+    }
+}
+
+static double steady(uint32_t i){
+    (void)i;
+    return 200.0;                               // 20.0mph
+}
+
+//
+// 5mph up to 40mph over 300 revolutions, 200 steady, coast down to 5mph
+// over 500
+//
+static double run_up(uint32_t i){
+    if(i < 300)
+        return 50.0 + 350.0 * i / 300;
+    if(i < 500)
+        return 400.0;
+    if(i < 1000)
+        return 400.0 - 350.0 * (i - 500) / 500;
+    return 50.0;
+}
+
+//
+// Worst reading error (tenths) over the trace after the first 8 periods,
+// and the worst raw one
+//
+static uint32_t replay(Filt_t *f, uint32_t *raw){
+    uint32_t i, shown, worst = 0;
+    int32_t err;
+
+    *raw = 0;
+    Filt_reset(f);
+    for(i = 0; i < trace.n; i++){
+        shown = Speed_tenths(Filt_add(f, trace.period[i]));
+        err = abs((int32_t)shown - (int32_t)trace.truth[i]);
+        if(i >= 8 && (uint32_t)err > worst)
+            worst = err;
+        err = abs((int32_t)Speed_tenths(trace.period[i]) - (int32_t)trace.truth[i]);
+        if((uint32_t)err > *raw)
+            *raw = err;
+    }
+    return worst;
+}
+
+static void test_replay(void){
+    Filt_t f;
+    uint32_t raw, worst, i, glitches = 0;
+
+    record(steady, 2000);
+    for(i = 0; i < trace.n; i++)
+        glitches += trace.glitch[i];
+    printf("  steady       %u periods, %u glitched\n", (unsigned)trace.n, (unsigned)glitches);
+
+    init(&f, FILT_AVG, 4, 0);
+    worst = replay(&f, &raw);
+    printf("  steady       raw off by %u, average %u", (unsigned)raw, (unsigned)worst);
+    CHECK(raw > 100 && worst > 20, "glitches move the raw and averaged reading");
+
+    init(&f, FILT_MEDIAN, 0, 0);
+    worst = replay(&f, &raw);
+    printf(", median %u", (unsigned)worst);
+    CHECK(worst <= 1, "median - glitches never shown");
+
+    init(&f, FILT_MEDIAN | FILT_AVG, 4, 0);
+    worst = replay(&f, &raw);
+    printf(", median + average %u", (unsigned)worst);
+    CHECK(worst <= 1, "median + average - steady to a tenth");
+
+    init(&f, FILT_MEDIAN | FILT_EMA, 0, 2);
+    worst = replay(&f, &raw);
+    printf(", median + EMA %u\n", (unsigned)worst);
+    CHECK(worst <= 1, "median + EMA - steady to a tenth");
+
+    //
+    // Run up and coast down - the filters lag, 2 periods for the median
+    // and about 2 more for the average or EMA, at up to 0.12mph a
+    // revolution (and the jitter)
+    //
+    record(run_up, 1100);
+    init(&f, FILT_MEDIAN | FILT_AVG, 4, 0);
+    worst = replay(&f, &raw);
+    printf("  run up       raw off by %u, median + average %u", (unsigned)raw, (unsigned)worst);
+    CHECK(worst <= 8, "median + average follows the run up");
+    init(&f, FILT_MEDIAN | FILT_EMA, 0, 2);
+    worst = replay(&f, &raw);
+    printf(", median + EMA %u\n", (unsigned)worst);
+    CHECK(worst <= 8, "median + EMA follows the run up");
+
+    //
+    // Wheel stopped and started again at another speed - a reset and the
+    // first period shows at once
+    //
+    init(&f, FILT_MEDIAN | FILT_AVG, 8, 0);
+    for(i = 0; i < 20; i++)
+        Filt_add(&f, period_of(300.0));
+    Filt_reset(&f);
+    CHECK(Speed_tenths(Filt_add(&f, period_of(100.0))) == 100, "restart - first period shown");
+    Filt_add(&f, period_of(100.0) / 3);
+    CHECK(Speed_tenths(f.out) == 100, "restart - split period not shown");
+}
+
+int main(void){
+    rnd_seed(11);
+    test_config();
+    test_reference();
+    test_replay();
+
+    return host_test_end("filt_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
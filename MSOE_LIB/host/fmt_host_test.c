@@ -0,0 +1,503 @@
+/*
+ * fmt_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     Fmt_udec / Fmt_dec against the pow10 based LCD routines
+ *      Rev:    0.2     Fmt_float_sci / Fmt_float_fix against printf
+ *      Rev:    0.3     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test and benchmark of msoe_lib_fmt
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -O2 -I host -I . -o fmt_host_test host/fmt_host_test.c msoe_lib_fmt.c
+ *      ./fmt_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <time.h>
+#include "host_test.h"
+#include "msoe_lib_fmt.h"
+
+//
+// Reference - the LCD_print_udec* / LCD_print_dec* code before msoe_lib_fmt,
+// printing into a buffer instead of the display
+//
+static char ref_buf[FMT_DEC_BUF + 4];
+static uint8_t ref_n;
+
+static void ref_char(char c){
+    ref_buf[ref_n++] = c;
+    ref_buf[ref_n] = 0;
+}
+
+int static pow10(uint8_t exp){
+    int8_t i;
+    int pow = 1;
+    for(i=0; i<exp; i++)
+        pow *= 10;
+    return pow;
+}
+
+static void ref_udec3(uint8_t val){
+    int8_t i;
+    uint8_t val_tmp = val;
+    ref_n = 0;
+    for(i=2; i>=0; i--){
+        if(i == 0 && val == 0)
+            ref_char('0');
+        else if(val >= (pow10(i))){
+            val_tmp = val_tmp / (pow10(i));
+            ref_char(val_tmp + 0x30);
+        }
+        else
+            ref_char(' ');
+        val_tmp = val % (int)pow10(i);
+    }
+}
+
+static void ref_udec5(uint16_t val){
+    int8_t i;
+    uint16_t val_tmp = val;
+    ref_n = 0;
+    for(i=4; i>=0; i--){
+        if(i == 0 && val == 0)
+            ref_char('0');
+        else if(val >= (pow10(i))){
+            val_tmp = val_tmp / (pow10(i));
+            ref_char(val_tmp + 0x30);
+        }
+        else
+            ref_char(' ');
+        val_tmp = val % (int)pow10(i);
+    }
+}
+
+static void ref_udec10(uint32_t val){
+    int8_t i;
+    uint32_t val_tmp = val;
+    ref_n = 0;
+    for(i=9; i>=0; i--){
+        if(i == 0 && val == 0)
+            ref_char('0');
+        else if(val >= (pow10(i))){
+            val_tmp = val_tmp / (pow10(i));
+            ref_char(val_tmp + 0x30);
+        }
+        else
+            ref_char(' ');
+        val_tmp = val % (int)pow10(i);
+    }
+}
+
+static void ref_dec3(int8_t val){
+    int8_t i;
+    int8_t val_tmp = val;
+    ref_n = 0;
+    if(val < 0){
+        ref_char('-');
+        val *= -1;
+        val_tmp *= -1;
+    }
+    for(i=2; i>=0; i--){
+        if(i == 0 && val == 0)
+            ref_char('0');
+        else if(val >= (pow10(i))){
+            val_tmp = val_tmp / (pow10(i));
+            ref_char(val_tmp + 0x30);
+        }
+        else
+            ref_char(' ');
+        val_tmp = val % (int)pow10(i);
+    }
+}
+
+static void ref_dec5(int16_t val){
+    int8_t i;
+    int16_t val_tmp = val;
+    ref_n = 0;
+    if(val < 0){
+        ref_char('-');
+        val *= -1;
+        val_tmp *= -1;
+    }
+    for(i=4; i>=0; i--){
+        if(i == 0 && val == 0)
+            ref_char('0');
+        else if(val >= (pow10(i))){
+            val_tmp = val_tmp / (pow10(i));
+            ref_char(val_tmp + 0x30);
+        }
+        else
+            ref_char(' ');
+        val_tmp = val % (int)pow10(i);
+    }
+}
+
+static void ref_dec10(int32_t val){
+    int8_t i;
+    int32_t val_tmp = val;
+    ref_n = 0;
+    if(val < 0){
+        ref_char('-');
+        val *= -1;
+        val_tmp *= -1;
+    }
+    for(i=9; i>=0; i--){
+        if(i == 0 && val == 0)
+            ref_char('0');
+        else if(val >= (pow10(i))){
+            val_tmp = val_tmp / (pow10(i));
+            ref_char(val_tmp + 0x30);
+        }
+        else
+            ref_char(' ');
+        val_tmp = val % (int)pow10(i);
+    }
+}
+
+//
+// Sampled 32 bit values - edges plus a fixed LCG sequence
+//
+static uint32_t lcg = 12345;
+
+static uint32_t next_sample(void){
+    lcg = lcg * 1664525UL + 1013904223UL;
+    return lcg >> (lcg & 0x1F);             // spread over all magnitudes
+}
+
+static void test_unsigned(void){
+    static const uint32_t edges[] = {0, 1, 9, 10, 99, 100, 65535, 65536, 999999999UL,
+                                     1000000000UL, 4294967295UL};
+    char buf[FMT_DEC_BUF];
+    uint32_t v;
+    uint32_t i;
+
+    for(v = 0; v <= 0xFF; v++){
+        ref_udec3((uint8_t)v);
+        CHECK(Fmt_udec(buf, v, 3) == 3 && strcmp(buf, ref_buf) == 0, "udec3");
+    }
+    for(v = 0; v <= 0xFFFF; v++){
+        ref_udec5((uint16_t)v);
+        CHECK(Fmt_udec(buf, v, 5) == 5 && strcmp(buf, ref_buf) == 0, "udec5");
+    }
+    for(i = 0; i < sizeof(edges) / sizeof(edges[0]); i++){
+        ref_udec10(edges[i]);
+        CHECK(strcmp((Fmt_udec(buf, edges[i], 10), buf), ref_buf) == 0, "udec10 edge");
+    }
+    for(i = 0; i < 1000000; i++){
+        v = next_sample();
+        ref_udec10(v);
+        Fmt_udec(buf, v, 10);
+        if(strcmp(buf, ref_buf) != 0){
+            CHECK(0, "udec10 sample");
+            printf("  %lu: '%s' '%s'\n", (unsigned long)v, buf, ref_buf);
+            break;
+        }
+    }
+}
+
+//
+// The old signed routines print "-   " for the most negative value
+// (negation overflows) - Fmt_dec prints it correctly
+//
+static void test_signed(void){
+    char buf[FMT_DEC_BUF];
+    int32_t v;
+    uint32_t i;
+
+    for(v = -128; v <= 127; v++){
+        Fmt_dec(buf, v, 3);
+        if(v == -128){
+            CHECK(strcmp(buf, "-128") == 0, "dec3 INT8_MIN");
+            continue;
+        }
+        ref_dec3((int8_t)v);
+        CHECK(strcmp(buf, ref_buf) == 0, "dec3");
+    }
+    for(v = -32768; v <= 32767; v++){
+        Fmt_dec(buf, v, 5);
+        if(v == -32768){
+            CHECK(strcmp(buf, "-32768") == 0, "dec5 INT16_MIN");
+            continue;
+        }
+        ref_dec5((int16_t)v);
+        CHECK(strcmp(buf, ref_buf) == 0, "dec5");
+    }
+    CHECK(Fmt_dec(buf, INT32_MIN, 10) == 11 && strcmp(buf, "-2147483648") == 0, "dec10 INT32_MIN");
+    CHECK(Fmt_dec(buf, INT32_MAX, 10) == 10 && strcmp(buf, "2147483647") == 0, "dec10 INT32_MAX");
+    CHECK(Fmt_dec(buf, -7, 10) == 11 && strcmp(buf, "-         7") == 0, "dec10 sign then width");
+    for(i = 0; i < 1000000; i++){
+        v = (int32_t)next_sample();
+        if(i & 1)
+            v = -v;
+        if(v == INT32_MIN)
+            continue;
+        ref_dec10(v);
+        Fmt_dec(buf, v, 10);
+        if(strcmp(buf, ref_buf) != 0){
+            CHECK(0, "dec10 sample");
+            printf("  %ld: '%s' '%s'\n", (long)v, buf, ref_buf);
+            break;
+        }
+    }
+}
+
+//
+// Reference float - LCD_print_float before msoe_lib_fmt
+//
+float static pow10f(int8_t exp){
+    int8_t i;
+    float pow = 1.0;
+    if(exp >= 0){
+        for(i=0; i<exp; i++)
+        pow *= 10;
+    }else{
+        for(i=0; i>exp; i--)
+        pow /= 10;
+    }
+    return pow;
+}
+
+static void ref_float(float val){
+    int8_t exp = -38;
+    uint16_t pow = 10000;
+    ref_n = 0;
+    if(val < 0){
+        val *= -1;
+        ref_char('-');
+    }
+    while(val >= pow10f(exp+1))
+        exp++;
+    val = pow * val * pow10f(0 - exp);
+    val += (pow * FLT_EPSILON * 10);
+    int val_tmp = ((int)val);
+    uint8_t i;
+    val_tmp = val / pow;
+    val -= val_tmp * pow;
+    pow /= 10;
+    ref_char(val_tmp + 0x30);
+    ref_char('.');
+    for(i=1; i<5; i++){
+        val_tmp = val / pow;
+        val -= val_tmp * pow;
+        pow /= 10;
+        ref_char(val_tmp + 0x30);
+    }
+    ref_char('E');
+    if(exp < 0){
+        ref_char('-');
+        exp *= -1;
+    }
+    if(exp > 9)
+        ref_char((exp / 10) + 0x30);
+    ref_char((exp % 10) + 0x30);
+}
+
+//
+// printf("%.4e") rewritten in the Fmt_float_sci form - 1.2346e+05 -> 1.2346E5
+//
+static void printf_sci(char *out, float val){
+    char tmp[32];
+    char *e;
+    int exp;
+
+    snprintf(tmp, sizeof(tmp), "%.4e", (double)val);
+    e = strchr(tmp, 'e');
+    exp = 0;
+    sscanf(e + 1, "%d", &exp);
+    *e = 0;
+    sprintf(out, "%sE%d", tmp, exp);
+}
+
+static float bits_to_float(uint32_t u){
+    union {
+        float f;
+        uint32_t u;
+    } bits;
+    bits.u = u;
+    return bits.f;
+}
+
+static void test_float_sci(void){
+    static const float edges[] = {0.0f, 1.0f, -1.0f, 9.99995f, 9.99994f, 99999.5f, 123455.0f,
+                                  123465.0f, 1.5e-45f, 1.17549435e-38f, 3.40282347e38f,
+                                  0.1f, 2.5f, 1e-10f, 65.5f};
+    char buf[FMT_DEC_BUF];
+    char ref[32];
+    uint32_t i;
+    uint32_t u;
+    uint32_t bad = 0;
+    float f;
+
+    for(i = 0; i < sizeof(edges) / sizeof(edges[0]); i++){
+        printf_sci(ref, edges[i]);
+        Fmt_float_sci(buf, edges[i]);
+        if(strcmp(buf, ref) != 0){
+            CHECK(0, "float sci edge");
+            printf("  %g: '%s' '%s'\n", (double)edges[i], buf, ref);
+        }
+    }
+    CHECK(Fmt_float_sci(buf, bits_to_float(0x7F800000UL)) == 3 && strcmp(buf, "INF") == 0, "INF");
+    CHECK(strcmp((Fmt_float_sci(buf, bits_to_float(0xFF800000UL)), buf), "-INF") == 0, "-INF");
+    CHECK(strcmp((Fmt_float_sci(buf, bits_to_float(0x7FC00000UL)), buf), "NAN") == 0, "NAN");
+
+    lcg = 777;
+    for(i = 0; i < 4000000; i++){           // random bit patterns - every exponent
+        lcg = lcg * 1664525UL + 1013904223UL;
+        u = lcg;
+        if(((u >> 23) & 0xFF) == 0xFF)
+            continue;
+        f = bits_to_float(u);
+        printf_sci(ref, f);
+        if(Fmt_float_sci(buf, f) != strlen(ref) || strcmp(buf, ref) != 0){
+            if(bad++ < 5)
+                printf("  %.9g: '%s' '%s'\n", (double)f, buf, ref);
+        }
+    }
+    for(u = 100000; u < 20000000; u += 5){  // integers - exact ties at the 5th digit
+        f = (float)u;
+        printf_sci(ref, f);
+        Fmt_float_sci(buf, f);
+        if(strcmp(buf, ref) != 0 && bad++ < 10)
+            printf("  %.9g: '%s' '%s'\n", (double)f, buf, ref);
+    }
+    CHECK(bad == 0, "float sci matches printf %.4e");
+}
+
+//
+// printf("%.*f") right aligned the Fmt_float_fix way - sign first, no "-0.0"
+//
+static void printf_fix(char *out, float val, int int_width, int frac){
+    char tmp[32];
+    char *p = tmp;
+    int neg = 0;
+    int len;
+
+    snprintf(tmp, sizeof(tmp), "%.*f", frac, (double)val);
+    if(*p == '-'){
+        neg = 1;
+        p++;
+    }
+    if(strspn(p, "0.") == strlen(p))        // rounds to 0
+        neg = 0;
+    len = int_width + frac + (frac != 0);
+    if((int)strlen(p) > len || len > 16){
+        memset(out, '*', len);
+        out[len] = 0;
+        return;
+    }
+    sprintf(out, "%s%*s", neg ? "-" : "", len, p);
+}
+
+static void test_float_fix(void){
+    static const uint8_t fmt[][2] = {{2, 1}, {3, 1}, {1, 0}, {3, 2}, {4, 3}, {1, 4}};
+    char buf[FMT_DEC_BUF];
+    char ref[64];
+    uint32_t i;
+    uint32_t j;
+    uint32_t bad = 0;
+    float f;
+    float range;
+
+    CHECK(Fmt_float_fix(buf, 7.96f, 2, 1) == 4 && strcmp(buf, " 8.0") == 0, "xx.x");
+    CHECK(strcmp((Fmt_float_fix(buf, 0.04f, 2, 1), buf), " 0.0") == 0, "zero");
+    CHECK(strcmp((Fmt_float_fix(buf, -0.04f, 2, 1), buf), " 0.0") == 0, "no -0.0");
+    CHECK(strcmp((Fmt_float_fix(buf, -5.25f, 2, 1), buf), "- 5.2") == 0, "negative, tie to even");
+    CHECK(strcmp((Fmt_float_fix(buf, 99.96f, 2, 1), buf), "****") == 0, "overflow");
+    CHECK(strcmp((Fmt_float_fix(buf, 123.0f, 3, 0), buf), "123") == 0, "no point");
+
+    for(j = 0; j < sizeof(fmt) / sizeof(fmt[0]); j++){
+        range = 1.0f;
+        for(i = 0; i < fmt[j][0]; i++)
+            range *= 10.0f;
+        lcg = 99 + j;
+        for(i = 0; i < 1000000; i++){
+            lcg = lcg * 1664525UL + 1013904223UL;
+            f = ((float)(lcg >> 8) / 16777216.0f * 2.0f - 1.0f) * range * 1.01f;
+            printf_fix(ref, f, fmt[j][0], fmt[j][1]);
+            Fmt_float_fix(buf, f, fmt[j][0], fmt[j][1]);
+            if(strcmp(buf, ref) != 0 && bad++ < 10)
+                printf("  %.9g %u.%u: '%s' '%s'\n", (double)f, fmt[j][0], fmt[j][1], buf, ref);
+        }
+    }
+    CHECK(bad == 0, "float fix matches printf %.*f");
+}
+
+//
+// Benchmark - the same sampled values through both
+//
+#define BENCH_N     2000000
+
+static volatile char sink;
+
+static void bench(void){
+    char buf[FMT_DEC_BUF];
+    clock_t t0;
+    double t_gen;
+    double t_ref;
+    double t_fmt;
+    uint32_t i;
+
+    lcg = 1;                                // sample generation alone
+    t0 = clock();
+    for(i = 0; i < BENCH_N; i++)
+        sink = (char)next_sample();
+    t_gen = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    lcg = 1;
+    t0 = clock();
+    for(i = 0; i < BENCH_N; i++){
+        ref_udec10(next_sample());
+        sink = ref_buf[9];
+    }
+    t_ref = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    lcg = 1;
+    t0 = clock();
+    for(i = 0; i < BENCH_N; i++){
+        Fmt_udec(buf, next_sample(), 10);
+        sink = buf[9];
+    }
+    t_fmt = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("  udec10  pow10 %.1f ns   Fmt_udec %.1f ns   per value\n",
+           (t_ref - t_gen) * 1e9 / BENCH_N, (t_fmt - t_gen) * 1e9 / BENCH_N);
+
+    lcg = 1;                                // floats over +-1e-30 to 1e30
+    t0 = clock();
+    for(i = 0; i < BENCH_N / 20; i++){
+        lcg = lcg * 1664525UL + 1013904223UL;
+        ref_float(bits_to_float((lcg & 0x80FFFFFFUL) | ((uint32_t)(27 + lcg % 200) << 23)));
+        sink = ref_buf[0];
+    }
+    t_ref = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    lcg = 1;
+    t0 = clock();
+    for(i = 0; i < BENCH_N / 20; i++){
+        lcg = lcg * 1664525UL + 1013904223UL;
+        Fmt_float_sci(buf, bits_to_float((lcg & 0x80FFFFFFUL) | ((uint32_t)(27 + lcg % 200) << 23)));
+        sink = buf[0];
+    }
+    t_fmt = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("  float   pow10f %.1f ns   Fmt_float_sci %.1f ns   per value\n",
+           t_ref * 1e9 / (BENCH_N / 20), t_fmt * 1e9 / (BENCH_N / 20));
+}
+
+int main(void){
+    test_unsigned();
+    test_signed();
+    test_float_sci();
+    test_float_fix();
+    bench();
+
+    return host_test_end("fmt_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,357 @@
+/*
+ * gov_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     load trace replay, change order, drivers following the clock
+ *      Rev:    0.2     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_gov and the Clock_notify drivers
+ *  Recorded load traces (work per period as % of the CPU at 48MHz) are
+ *  replayed - the load the governor sees is the work scaled by the
+ *  divider it picked. A test driver registered with Clock_notify checks
+ *  the core voltage and flash wait states around every change, and that
+ *  the timebase, SysTick tick and LCD SPI clock follow (or refuse)
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o gov_host_test host/gov_host_test.c msoe_lib_gov.c msoe_lib_clk.c msoe_lib_time.c msoe_lib_sched.c msoe_lib_timer.c msoe_lib_lcd.c msoe_lib_fmt.c host/msp432_host.c
+ *      ./gov_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <setjmp.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_gov.h"
+#include "msoe_lib_time.h"
+#include "msoe_lib_sched.h"
+#include "msoe_lib_timer.h"
+#include "msoe_lib_lcd.h"
+
+void TA2_N_IRQHandler(void);
+void EUSCIA3_IRQHandler(void);
+
+////////////////////////////////////////////
+//
+// Clock change watcher
+//
+////////////////////////////////////////////
+//
+// Registered after the other drivers (test_lcd runs first) - sees the
+// state they left before and after each change
+//      MCLK allowed by the core voltage and wait states, old and new clock
+//      SCLK (SMCLK / BRW) within the LCD's 4MHz, old and new clock
+//
+static uint32_t before, after, unsafe;
+static uint8_t refuse;
+
+static uint32_t mclk_max(void){
+    uint32_t vcore = (PCM->CTL0 >> 8) & 0x3F;
+    uint32_t wait = (FLCTL->BANK0_RDCTL >> 12) & 0xF;
+    uint32_t max = vcore ? 48000000 : 24000000;
+    if(wait == 0 && max > 12000000)
+        max = 12000000;
+    return max;
+}
+
+static uint8_t sclk_ok(uint32_t smclk){
+    uint16_t brw = host_eusci_a3.BRW;
+    return brw == 0 || smclk / brw <= 4000000;
+}
+
+static uint8_t watch(uint8_t when, const Clock_freq_t *next){
+    if(when == CLOCK_BEFORE){
+        before++;
+        unsafe += Clock_MCLK_freq > mclk_max() || next->mclk > mclk_max();
+        unsafe += !sclk_ok(Clock_SMCLK_freq) || !sclk_ok(next->smclk);
+        return refuse;
+    }
+    after++;
+    unsafe += Clock_MCLK_freq > mclk_max() || !sclk_ok(Clock_SMCLK_freq);
+    return 0;
+}
+
+//
+// Clock_Init_48MHz with the power modes changing at once - 48MHz, VCORE1,
+// 1 wait state
+//
+static void hw_clock(void){
+    host_reset();
+    host_pcm_follow = 1;
+    CS->STAT = 0x0F020004;
+    Clock_Init_48MHz();
+    Time_Init();
+    Gov_Init(0);
+}
+
+static void hw_watch(void){
+    Clock_notify(watch);
+    before = after = unsafe = 0;
+    refuse = 0;
+}
+
+static void hw_start(void){
+    hw_clock();
+    hw_watch();
+}
+
+////////////////////////////////////////////
+//
+// Load trace replay
+//
+////////////////////////////////////////////
+//
+// Each trace entry is one period's work in % of the CPU at 48MHz - the
+// load seen is work x divider (100 at most, the rest is late)
+//
+typedef struct {
+    const char *name;
+    const uint8_t *work;
+    const uint8_t *want;                // divider after each period
+    uint32_t n;
+} trace_t;
+
+static const uint8_t bursty[] = {5, 5, 5, 5, 5, 5, 5, 90, 90, 5, 5, 5, 5, 5, 5};
+static const uint8_t bursty_div[] = {1, 1, 2, 2, 2, 4, 4, 1, 1, 1, 1, 2, 2, 2, 4};
+static const uint8_t spike[] = {10, 10, 10, 10, 10, 10, 60, 10, 10, 10, 10, 10, 10};
+static const uint8_t spike_div[] = {1, 1, 2, 2, 2, 4, 1, 1, 1, 2, 2, 2, 4};
+//
+// Mid loads - 25% settles at /2 (50%), 12% at /4 (48%) - no flapping
+//
+static const uint8_t steady[] = {25, 25, 25, 25, 25, 25, 25, 25, 12, 12, 12, 12, 12, 12, 12, 12};
+static const uint8_t steady_div[] = {1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4};
+//
+// Loads between the thresholds break the quiet count
+//
+static const uint8_t flicker[] = {5, 5, 40, 5, 5, 40, 5, 5, 5};
+static const uint8_t flicker_div[] = {1, 1, 1, 1, 1, 1, 1, 1, 2};
+
+static const trace_t traces[] = {
+    {"bursty", bursty, bursty_div, sizeof(bursty)},
+    {"spike", spike, spike_div, sizeof(spike)},
+    {"steady", steady, steady_div, sizeof(steady)},
+    {"flicker", flicker, flicker_div, sizeof(flicker)},
+};
+
+static void test_replay(void){
+    uint32_t t, i, load, late, mhz;
+    int ok;
+
+    for(t = 0; t < sizeof(traces) / sizeof(traces[0]); t++){
+        hw_start();
+        ok = Gov_divider == 1;
+        late = 0;
+        mhz = 0;
+        for(i = 0; i < traces[t].n; i++){
+            load = traces[t].work[i] * Gov_divider;
+            late += load > 100;
+            Gov_update(load > 100 ? 100 : load);
+            mhz += Clock_MCLK_freq / 1000000;
+            if(Gov_divider != traces[t].want[i]){
+                printf("  %s period %u: /%u, want /%u\n", traces[t].name, (unsigned)i,
+                       (unsigned)Gov_divider, (unsigned)traces[t].want[i]);
+                ok = 0;
+            }
+            ok &= Clock_MCLK_freq == 48000000UL / Gov_divider;
+        }
+        CHECK(ok, "divider follows the trace");
+        CHECK(late <= 1 && unsafe == 0 && Gov_refused == 0, "at most one late period, every change safe");
+        CHECK(before == Gov_changes && after == Gov_changes, "drivers told of each change");
+        printf("  %-8s     %u changes, %u late, average MCLK %uMHz\n", traces[t].name,
+               (unsigned)Gov_changes, (unsigned)late, (unsigned)(mhz / traces[t].n));
+    }
+}
+
+////////////////////////////////////////////
+//
+// Operating points
+//
+////////////////////////////////////////////
+static uint32_t vcore(void){ return (PCM->CTL0 >> 8) & 0x3F; }
+static uint32_t wait(void){ return (FLCTL->BANK0_RDCTL >> 12) & 0xF; }
+
+static void test_apply(void){
+    static const Gov_cfg_t slow8 = {80, 30, 1, 8, 100000};
+
+    hw_start();
+    CHECK(vcore() == 1 && wait() == 1, "48MHz - VCORE1, 1 wait state");
+    CHECK(Gov_apply(2) == 0 && vcore() == 0 && wait() == 1 && CS->CTL1 == 0x30210255, "24MHz - VCORE0, 1 wait state");
+    CHECK(Gov_apply(4) == 0 && vcore() == 0 && wait() == 0 && Clock_MCLK_freq == 12000000, "12MHz - 0 wait states");
+    CHECK(Gov_apply(1) == 0 && vcore() == 1 && wait() == 1 && Clock_MCLK_freq == 48000000, "back to 48MHz in one step");
+    CHECK(FLCTL->BANK1_RDCTL == FLCTL->BANK0_RDCTL, "both banks");
+    CHECK(unsafe == 0 && before == 3 && after == 3, "voltage up before, down after");
+
+    //
+    // A driver refuses - no change, voltage and wait states put back
+    //
+    Gov_apply(2);
+    refuse = 1;
+    CHECK(Gov_apply(1) == 3 && Gov_divider == 2 && vcore() == 0 && wait() == 1 && Clock_MCLK_freq == 24000000,
+          "refused speed up undone");
+    CHECK(Gov_apply(4) == 3 && Gov_divider == 2 && wait() == 1, "refused slow down");
+    CHECK(Gov_update(100) == 2 && Gov_refused == 1, "counted, tried again next period");
+    refuse = 0;
+    CHECK(Gov_update(100) == 1 && vcore() == 1, "then made");
+
+    //
+    // The core voltage does not change - the clock stays slow
+    //
+    Gov_apply(2);
+    host_pcm_follow = 0;
+    CHECK(Gov_apply(1) == 4 && Gov_divider == 2 && wait() == 1 && CS->CTL1 == 0x30210255, "VCORE1 failure - no faster clock");
+    host_pcm_follow = 1;
+    CHECK(unsafe == 0, "all safe");
+
+    //
+    // /8 - SMCLK 1.5MHz, the timebase refuses
+    //
+    Gov_Init(&slow8);
+    Gov_apply(4);
+    CHECK(Gov_apply(8) == 3 && Gov_divider == 4 && Clock_SMCLK_freq == 3000000, "timebase refuses /8");
+    CHECK(Gov_update(0) == 4 && Gov_refused == 1, "governor stays at /4");
+}
+
+////////////////////////////////////////////
+//
+// Drivers following the clock
+//
+////////////////////////////////////////////
+static void test_drivers(void){
+    uint32_t t0;
+
+    //
+    // Timebase - count kept, SMCLK still divided to 1MHz
+    //
+    hw_start();
+    TIMER_A2->R = 1234;
+    t0 = Time_now_us();
+    Gov_apply(2);                       // SMCLK 6MHz - /1 /6
+    CHECK(Time_now_us() == t0 && ((TIMER_A2->CTL >> 6) & 3) == 0 && TIMER_A2->EX0 == 5, "timebase at 6MHz");
+    CHECK((TIMER_A2->CTL & 0x0232) == 0x0222, "SMCLK, continuous, overflow interrupt");
+    Gov_apply(4);                       // 3MHz - /1 /3
+    CHECK(Time_now_us() == t0 && TIMER_A2->EX0 == 2, "timebase at 3MHz");
+    Gov_apply(1);
+    CHECK(Time_now_us() == t0 && ((TIMER_A2->CTL >> 6) & 3) == 1 && TIMER_A2->EX0 == 5, "timebase at 12MHz");
+
+    //
+    // SysTick - the tick rate is kept
+    //
+    Timer_Init(48000000, 1000);
+    CHECK(SysTick->LOAD == 47999, "1ms tick at 48MHz");
+    Gov_apply(4);
+    CHECK(SysTick->LOAD == 11999 && (SysTick->CTRL & 0x0007) == 0x0007, "1ms tick at 12MHz");
+    Gov_apply(1);
+    Timer_Init(48000000, 10000000);     // 4 clocks a tick
+    CHECK(Gov_apply(2) == 0 && SysTick->LOAD == 1, "2 clocks a tick");
+    CHECK(Gov_apply(4) == 3 && Gov_divider == 2, "1 clock a tick - refused");
+    SysTick->CTRL = 0;                  // stopped - no longer follows
+    CHECK(Gov_apply(4) == 0, "SysTick stopped");
+}
+
+//
+// LCD - refused while sending, SCLK at most 4MHz
+//
+static void test_lcd(void){
+    hw_clock();
+    host_dc_port = P9;
+    host_dc_mask = 0x04;
+    LCD_Config();
+    hw_watch();
+    CHECK(host_eusci_a3.BRW == 3, "SCLK 12MHz / 3");
+    CHECK(Gov_apply(2) == 3 && Gov_divider == 1 && host_eusci_a3.BRW == 3, "busy - refused");
+    while(host_eusci_a3.IE & 0x0002)
+        EUSCIA3_IRQHandler();
+    while(LCD_flush_busy())
+        host_dma_run(6);
+    CHECK(Gov_apply(2) == 0 && host_eusci_a3.BRW == 2, "6MHz / 2");
+    CHECK(Gov_apply(4) == 0 && host_eusci_a3.BRW == 1, "3MHz / 1");
+    CHECK(Gov_apply(1) == 0 && host_eusci_a3.BRW == 3 && unsafe == 0, "12MHz / 3 - raised before the change");
+    CHECK((host_eusci_a3.CTLW0 & 0x0001) == 0, "out of SW reset");
+}
+
+////////////////////////////////////////////
+//
+// Gov_poll on the scheduler's sleep time
+//
+////////////////////////////////////////////
+//
+// A 1ms tick posts the work (the trace value in % of 1ms at 48MHz) and a
+// governor poll. The work takes longer at a slower clock. Sleeping moves
+// the time on to the next tick
+//
+static const uint8_t phases[] = {5, 60, 12};        // 1s each
+static uint64_t now;                    // true time in us
+static uint32_t ticks;
+static int8_t work_id, gov_id;
+static uint32_t work_q[4], gov_q[4];
+static uint8_t div_end[3];
+static jmp_buf run_done;
+
+static void advance(uint32_t us){
+    uint64_t t = now + us;
+    if((t >> 16) != (now >> 16)){
+        TIMER_A2->CTL |= 0x0001;        // overflow
+        TIMER_A2->R = (uint16_t)t;
+        TA2_N_IRQHandler();
+    }
+    TIMER_A2->R = (uint16_t)t;
+    now = t;
+}
+
+static void work(uint32_t pct){
+    advance(pct * 10 * Gov_divider);    // pct % of 1000us at 48MHz
+}
+
+static void gov(uint32_t ev){
+    (void)ev;
+    Gov_poll();
+}
+
+static void wfi_tick(void){
+    uint32_t phase;
+
+    advance(1000 - (uint32_t)(now % 1000));
+    phase = ticks / 1000;
+    if(ticks % 1000 == 999)
+        div_end[phase] = Gov_divider;
+    if(++ticks > 3000)
+        longjmp(run_done, 1);
+    Sched_post(work_id, phases[ticks / 1000 < 3 ? ticks / 1000 : 2]);
+    Sched_post(gov_id, 0);
+}
+
+static void test_poll(void){
+    hw_start();
+    Sched_Init();
+    work_id = Sched_task(work, 0, work_q, 4);
+    gov_id = Sched_task(gov, 1, gov_q, 4);
+    Sched_clock(Time_now_us);
+    now = 0;
+    ticks = 0;
+    host_wfi_hook = wfi_tick;
+    if(!setjmp(run_done))
+        Sched_run();
+    host_wfi_hook = 0;
+    Sched_clock(0);
+
+    CHECK(div_end[0] == 4, "5% - /4 within 1s");
+    CHECK(div_end[1] == 1, "60% - back to /1");
+    CHECK(div_end[2] == 4, "12% - /4 again");
+    CHECK(Gov_refused == 0 && unsafe == 0, "no refusals");
+    printf("  poll         %u changes over %u ticks, %u us asleep\n", (unsigned)Gov_changes,
+           (unsigned)ticks - 1, (unsigned)Sched_sleep_us());
+}
+
+int main(void){
+    test_lcd();
+    test_replay();
+    test_apply();
+    test_drivers();
+    test_poll();
+
+    return host_test_end("gov_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
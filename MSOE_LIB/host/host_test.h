@@ -0,0 +1,53 @@
+/*
+ * host_test.h
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *      Rev:    0.1     failure count, CHECK, pseudo random numbers
+ *
+ */
+#ifndef __MSOE_LIB_HOST_TEST_H__
+#define __MSOE_LIB_HOST_TEST_H__
+////////////////////////////////////////////
+//
+// Shared parts of the host (Linux) tests - include once, from the test
+//
+//      CHECK(cond, msg)    prints the line and msg when cond is false and
+//                          counts the failure
+//      rnd_seed(seed)      starts the sequence (each test keeps its own seed
+//      rnd()               so its streams do not change) - 24 bit LCG values
+//      host_test_end(name) prints the PASS / FAIL line, returns the exit code
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdio.h>
+#include <stdint.h>
+
+static int fails = 0;
+
+#define CHECK(cond, msg)                                        \
+    do {                                                        \
+        if(!(cond)){                                            \
+            printf("FAIL line %d: %s\n", __LINE__, msg);        \
+            fails++;                                            \
+        }                                                       \
+    } while(0)
+
+static uint32_t host_rng = 1;
+
+static inline void rnd_seed(uint32_t seed){
+    host_rng = seed;
+}
+
+static inline uint32_t rnd(void){
+    host_rng = host_rng * 1103515245 + 12345;
+    return host_rng >> 8;
+}
+
+static inline int host_test_end(const char *name){
+    printf("%s: %s (%d failures)\n", name, fails ? "FAIL" : "PASS", fails);
+    return fails != 0;
+}
+
+#endif // __MSOE_LIB_HOST_TEST_H__
@@ -0,0 +1,696 @@
+/*
+ * lcd_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     framebuffer / DMA flush checks
+ *      Rev:    0.2     dirty span flush - display emulation and byte counts
+ *      Rev:    0.3     interrupt driven TX queue - ordering and D/C checks
+ *      Rev:    0.4     also builds against the alternate pinout (-DLCD_ALT_IO)
+ *      Rev:    0.5     SPI transaction counts for string and big string rendering
+ *      Rev:    0.6     decimal print through msoe_lib_fmt
+ *      Rev:    0.7     big font strips and the SRAM digit cache against ASCII_BIG
+ *      Rev:    0.8     run length encoded bitmaps - round trip of every MSOE_LIB bitmap
+ *      Rev:    0.9     sprite blit against a per pixel reference
+ *      Rev:    0.10    direct writes queued around a waiting flush
+ *      Rev:    0.11    printing from a SysTick callback and with interrupts off
+ *      Rev:    0.12    CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of the LCD driver against the register model in host/msp432.h
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o lcd_host_test host/lcd_host_test.c msoe_lib_lcd.c msoe_lib_fmt.c msoe_lib_clk.c msoe_lib_timer.c host/msp432_host.c
+ *      ./lcd_host_test
+ *
+ *  Alternate pinout:
+ *      gcc -std=c99 -DLCD_ALT_IO -I host -I . -o lcd_host_test_alt host/lcd_host_test.c msoe_lib_lcd_alt_io.c msoe_lib_fmt.c msoe_lib_clk.c msoe_lib_timer.c host/msp432_host.c
+ *      ./lcd_host_test_alt
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <string.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_lcd.h"
+#include "msoe_lib_timer.h"
+
+#include "pu1.h"
+#include "msoe1.h"
+#include "bat1.h"
+#include "test_bmp.h"
+#include "pu1_rle.h"
+#include "msoe1_rle.h"
+#include "bat1_rle.h"
+#include "test_bmp_rle.h"
+#include "host/bmp_rle_enc.h"
+
+//
+// Peripherals used by the driver build under test
+//
+#if defined(LCD_ALT_IO)
+#define TEST_EUSCI          host_eusci_a1
+#define TEST_IRQHandler     EUSCIA1_IRQHandler
+#define TEST_DMA_CH         2
+#define TEST_DC_PORT        P1
+#define TEST_DC_PIN         0x80
+#else
+#define TEST_EUSCI          host_eusci_a3
+#define TEST_IRQHandler     EUSCIA3_IRQHandler
+#define TEST_DMA_CH         6
+#define TEST_DC_PORT        P9
+#define TEST_DC_PIN         0x04
+#endif
+
+void TEST_IRQHandler(void);
+void DMA_INT1_IRQHandler(void);
+void SysTick_Handler(void);
+
+static int flush_done = 0;
+
+static void flush_cb(void){
+    flush_done++;
+}
+
+//
+// PCD8544 DDRAM emulation fed from the captured SPI stream
+//
+static uint8_t ddram[LCD_FB_SIZE];
+static uint8_t ddram_x = 0;
+static uint8_t ddram_y = 0;
+static uint8_t ddram_ext = 0;
+static uint32_t ddram_seen = 0;
+
+static void ddram_update(void){
+    for(; ddram_seen < host_spi_count; ddram_seen++){
+        uint8_t d = host_spi_log[ddram_seen].data;
+        if(host_spi_log[ddram_seen].dc){
+            ddram[ddram_y * LCD_COLS + ddram_x] = d;
+            if(++ddram_x == LCD_COLS){
+                ddram_x = 0;
+                if(++ddram_y == LCD_BANKS)
+                    ddram_y = 0;
+            }
+        }
+        else if((d & 0xF8) == 0x20)         // function set
+            ddram_ext = d & 0x01;
+        else if(!ddram_ext && (d & 0x80))   // X address
+            ddram_x = d & 0x7F;
+        else if(!ddram_ext && (d & 0xF8) == 0x40)   // Y address
+            ddram_y = d & 0x07;
+    }
+}
+
+//
+// Restart the capture log - for tests that send more than HOST_SPI_LOG_SIZE
+// bytes, call between flushes once the stream is in the emulated DDRAM
+//
+static void log_rewind(void){
+    ddram_update();
+    host_spi_count = 0;
+    host_spi_dma_bytes = 0;
+    host_spi_dma_bursts = 0;
+    ddram_seen = 0;
+}
+
+//
+// Service the TX interrupt and run DMA transfers until the queue is empty
+// and the flush completes, return bytes sent since start
+//
+static uint32_t run_flush(uint32_t start){
+    for(;;){
+        if(TEST_EUSCI.IE & 0x0002)
+            TEST_IRQHandler();
+        else if(!LCD_flush_busy() || host_dma_run(TEST_DMA_CH) == 0)
+            break;
+    }
+    ddram_update();
+    return host_spi_count - start;
+}
+
+//
+// CPU writes to TXBUF plus DMA bursts
+//
+static uint32_t transactions(void){
+    return host_spi_count - host_spi_dma_bytes + host_spi_dma_bursts;
+}
+
+//
+// Check that captured bytes [start, start+n) are data bytes matching ref
+//
+static int stream_matches(uint32_t start, const uint8_t *ref, uint32_t n){
+    uint32_t i;
+    for(i = 0; i < n; i++){
+        if(host_spi_log[start + i].dc != 1 || host_spi_log[start + i].data != ref[i])
+            return 0;
+    }
+    return 1;
+}
+
+static void test_config(void){
+    static const uint8_t cfg[] = {0x21, 0x04, 0x14, 0xB1, 0x20, 0x0C, 0x80, 0x40};
+    static const uint8_t blank[LCD_FB_SIZE];
+    uint32_t i;
+
+    host_reset();
+    memset(ddram, 0xA5, sizeof(ddram));     // power up garbage
+    LCD_Config();
+    CHECK(LCD_flush_busy() == 1, "flush waiting after LCD_Config");
+    CHECK(host_spi_count == 0, "config commands queued");
+    CHECK(TEST_EUSCI.IE & 0x0002, "TX interrupt enabled");
+
+    while(TEST_EUSCI.IE & 0x0002)
+        TEST_IRQHandler();
+    CHECK(host_spi_count == sizeof(cfg), "only commands sent before the DMA runs");
+    for(i = 0; i < sizeof(cfg); i++)
+        CHECK(host_spi_log[i].data == cfg[i] && host_spi_log[i].dc == 0, "config command");
+
+    CHECK(host_dma_run(TEST_DMA_CH) == LCD_FB_SIZE - 1, "whole screen is one DMA transfer");
+    CHECK(LCD_flush_busy() == 0, "flush complete after DMA interrupt");
+    CHECK(host_spi_count == sizeof(cfg) + LCD_FB_SIZE, "504 data bytes");
+    CHECK(stream_matches(sizeof(cfg), blank, LCD_FB_SIZE), "blank screen");
+    ddram_update();
+    CHECK(memcmp(ddram, blank, LCD_FB_SIZE) == 0, "display blank");
+}
+
+static void check_bmp(const char *bmp, const char *name){
+    uint32_t start = host_spi_count;
+    uint32_t sent;
+
+    LCD_print_bmpArray(bmp);
+    sent = run_flush(start);
+    CHECK(memcmp(ddram, bmp, LCD_FB_SIZE) == 0, name);
+    CHECK(memcmp(LCD_framebuffer(), bmp, LCD_FB_SIZE) == 0, name);
+    printf("  %-10s %3u bytes\n", name, (unsigned)sent);
+
+    start = host_spi_count;
+    LCD_print_bmpArray(bmp);            // same picture again - nothing to send
+    CHECK(run_flush(start) == 0, "unchanged bitmap sends nothing");
+}
+
+static void test_shadow(void){
+    uint8_t *fb = LCD_framebuffer();
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    LCD_goto_xy(2, 3);
+    LCD_print_char('A');
+    CHECK(fb[3 * LCD_COLS + 14] == 0x00, "left pad column");
+    CHECK(memcmp(&fb[3 * LCD_COLS + 15], ASCII['A' - 0x20], 5) == 0, "glyph in framebuffer");
+    LCD_goto_xy(11, 5);                 // last character cell wraps to 0,0
+    LCD_print_str("AB");
+    CHECK(memcmp(&fb[1], ASCII['B' - 0x20], 5) == 0, "wrap at end of DDRAM");
+    run_flush(host_spi_count);
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "direct writes match framebuffer");
+}
+
+//
+// Typical speed display updates in buffered mode
+//
+static void test_incremental(void){
+    uint32_t start;
+    uint32_t sent;
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    LCD_buffered(1);
+
+    start = host_spi_count;
+    LCD_clear();
+    LCD_flush();
+    CHECK(run_flush(start) == 0, "clear of a blank screen sends nothing");
+
+    start = host_spi_count;
+    LCD_goto_xy(4, 2);
+    LCD_print_str("12.5");
+    LCD_goto_xy(0, 5);
+    LCD_print_str("MPH");
+    LCD_flush();
+    sent = run_flush(start);
+    CHECK(sent <= 2 + 4 * 7 + 2 + 3 * 7, "two short spans");
+    CHECK(memcmp(ddram, LCD_framebuffer(), LCD_FB_SIZE) == 0, "display matches after first flush");
+    printf("  first draw %3u bytes\n", (unsigned)sent);
+
+    start = host_spi_count;
+    LCD_goto_xy(4, 2);
+    LCD_print_str("12.7");              // one digit changes
+    LCD_flush();
+    sent = run_flush(start);
+    CHECK(sent <= 2 + 7, "one digit span");
+    CHECK(memcmp(ddram, LCD_framebuffer(), LCD_FB_SIZE) == 0, "display matches after update");
+    printf("  one digit  %3u bytes (full screen %u)\n", (unsigned)sent, LCD_FB_SIZE + 2);
+
+    start = host_spi_count;
+    LCD_goto_xy(4, 2);
+    LCD_print_str("12.7");              // no change
+    LCD_flush();
+    CHECK(run_flush(start) == 0, "redraw of the same value sends nothing");
+
+    LCD_buffered(0);
+}
+
+//
+// Direct writes go through the TX queue
+//
+static void test_queue(void){
+    static const uint8_t goto_0_1[] = {0x80, 0x41};
+    uint8_t *fb = LCD_framebuffer();
+    uint32_t start;
+    uint32_t i;
+
+    LCD_clear();
+    run_flush(host_spi_count);
+
+    start = host_spi_count;
+    LCD_goto_xy(0, 1);
+    LCD_print_char('H');
+    LCD_print_char('I');
+    CHECK(host_spi_count == start, "print returns without sending");
+    CHECK(TEST_EUSCI.IE & 0x0002, "TX interrupt enabled");
+
+    fb[5 * LCD_COLS] = 0xFF;                // flush requested behind the queued bytes
+    LCD_fb_dirty(5, 0, 0);
+    LCD_flush();
+    CHECK(LCD_flush_busy() == 1, "flush waits for the queue");
+    CHECK(host_spi_count == start, "flush does not overtake the queue");
+
+    run_flush(start);
+    CHECK(host_spi_count - start == 2 + 2 * 7 + 2 + 1, "queue then flush");
+    for(i = 0; i < 2; i++)
+        CHECK(host_spi_log[start + i].data == goto_0_1[i] && host_spi_log[start + i].dc == 0, "address command");
+    CHECK(stream_matches(start + 2, &fb[LCD_COLS], 2 * 7), "queued data");
+    CHECK(host_spi_log[start + 16].data == 0x80 && host_spi_log[start + 16].dc == 0, "flush X after the data");
+    CHECK(host_spi_log[start + 17].data == 0x45 && host_spi_log[start + 17].dc == 0, "flush Y");
+    CHECK(host_spi_log[start + 18].data == 0xFF && host_spi_log[start + 18].dc == 1, "flush data");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches framebuffer");
+
+    start = host_spi_count;                 // print while a DMA flush runs
+    LCD_fb_dirty(0, 0, LCD_COLS - 1);
+    LCD_flush();
+    LCD_goto_xy(3, 4);
+    LCD_print_char('Z');
+    CHECK(!(TEST_EUSCI.IE & 0x0002), "queue held while the flush owns the SPI");
+    host_dma_run(TEST_DMA_CH);
+    CHECK(TEST_EUSCI.IE & 0x0002, "queue released when the flush completes");
+    run_flush(start);
+    CHECK(host_spi_count - start == 2 + LCD_COLS + 2 + 7, "flush then queue");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after queued print");
+}
+
+//
+// A flush waiting behind queued bytes starts when the queue drains and
+// moves the controller address - a direct write after that must address
+// again ('D' used to land on 'C')
+//
+static void test_queue_flush_addr(void){
+    static const uint8_t d_glyph[7] = {0x00, 0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00};
+    uint8_t *fb = LCD_framebuffer();
+
+    LCD_clear();
+    run_flush(host_spi_count);
+
+    LCD_goto_xy(0, 0);
+    LCD_print_char('A');
+    LCD_print_str("B");                     // flush waits for 'A'
+    LCD_print_char('C');                    // queued behind 'A'
+    CHECK(LCD_flush_busy(), "flush waiting");
+    while(TEST_EUSCI.IE & 0x0002)           // queue drains, the flush starts
+        TEST_IRQHandler();
+    CHECK(LCD_flush_busy(), "flush running");
+    LCD_print_char('D');
+    run_flush(host_spi_count);
+
+    CHECK(memcmp(&fb[21], d_glyph, 7) == 0, "'D' after 'C' in the framebuffer");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches framebuffer");
+
+    LCD_print_char('E');                    // flush done - address again once
+    run_flush(host_spi_count);
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after the flush");
+}
+
+//
+// Printing from a SysTick callback - the eUSCI and DMA interrupts are the
+// same priority and cannot run, so the print routines drain the queue and
+// run the flush themselves. A driver that waits for the interrupts hangs here
+//
+static uint8_t tick_prints = 0;
+
+static void tick_print(void){
+    uint8_t i;
+
+    LCD_print_str("TICK");                  // flush running - DMA armed
+    LCD_goto_xy(0, 1);
+    for(i = 0; i < 48; i++)                 // 336 bytes behind the flush - queue full
+        LCD_print_char('0' + i % 10);
+    tick_prints++;
+}
+
+static void test_tick_print(void){
+    uint8_t *fb = LCD_framebuffer();
+    uint8_t i;
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    log_rewind();
+
+    Timer_Init(48000000, 1000);
+    Timer_start(tick_print, 1, 1);
+    host_dma_poll = 1;                      // DMA finishes, its interrupt stays pending
+    host_ipsr = 15;                         // SysTick
+    SysTick_Handler();
+    host_ipsr = 0;
+    host_dma_poll = 0;
+    CHECK(tick_prints == 1, "callback returned with the queue full");
+    CHECK(LCD_flush_busy() == 0, "flush finished in the callback");
+    DMA_INT1_IRQHandler();                  // the pending interrupt - nothing to do
+    run_flush(host_spi_count);
+    CHECK(memcmp(&fb[LCD_COLS + 1], ASCII['0' - 0x20], 5) == 0, "digits in the framebuffer");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after printing in SysTick");
+
+    log_rewind();
+    LCD_goto_xy(0, 3);
+    host_primask = 1;                       // interrupts off
+    for(i = 0; i < 48; i++)
+        LCD_print_char('A' + i % 26);
+    host_primask = 0;
+    run_flush(host_spi_count);
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after printing with interrupts off");
+}
+
+//
+// Status line and big digits - batched rendering against per character writes
+//
+static void test_batch(void){
+    static char line[] = "SPD 12.5 MPH";
+    uint32_t start;
+    uint32_t t_char;
+    uint32_t t_str;
+    uint32_t t_big;
+    uint32_t i;
+    uint32_t cmds;
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    start = transactions();
+    LCD_goto_xy(0, 0);
+    for(i = 0; line[i] != 0; i++)
+        LCD_print_char(line[i]);
+    run_flush(host_spi_count);
+    t_char = transactions() - start;
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    start = transactions();
+    LCD_goto_xy(0, 0);
+    LCD_print_str(line);
+    run_flush(host_spi_count);
+    t_str = transactions() - start;
+    CHECK(memcmp(ddram, LCD_framebuffer(), LCD_FB_SIZE) == 0, "display matches after LCD_print_str");
+    CHECK(t_str * 4 <= t_char, "string is one burst");
+    printf("  status line  %3u transactions (per character %u)\n", (unsigned)t_str, (unsigned)t_char);
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    start = host_spi_count;
+    t_big = transactions();
+    LCD_print_bigstr(0, 1, "12.5");
+    run_flush(start);
+    t_big = transactions() - t_big;
+    for(cmds = 0, i = start; i < host_spi_count; i++)
+        cmds += host_spi_log[i].dc == 0;
+    CHECK(cmds == 4, "one X/Y address per half row");
+    CHECK(memcmp(ddram, LCD_framebuffer(), LCD_FB_SIZE) == 0, "display matches after LCD_print_bigstr");
+    CHECK(t_big * 4 <= 4 * (4 + 20), "big string is one burst per half row");
+    printf("  big digits   %3u transactions (per character %u)\n", (unsigned)t_big, 4 * (4 + 20));
+}
+
+//
+// Big font strips match ASCII_BIG - every character, through LCD_print_bigchar
+// (cached digits and flash strips)
+//
+static void test_bigfont(void){
+    uint8_t *fb = LCD_framebuffer();
+    uint32_t glyphs = sizeof(ASCII_BIG) / sizeof(ASCII_BIG[0]);
+    uint32_t g;
+    uint32_t i;
+    uint32_t start;
+    uint16_t upper;
+    int ok_strip = 1;
+    int ok_fb = 1;
+
+    CHECK(sizeof(ASCII_BIG_STRIP) / sizeof(ASCII_BIG_STRIP[0]) == glyphs, "one strip per big character");
+    CHECK(ASCII_BIG_LAST - ASCII_BIG_FIRST + 1 == glyphs, "strip range");
+    for(g = 0; g < glyphs; g++){
+        ok_strip &= ASCII_BIG_STRIP[g][0][0] == 0 && ASCII_BIG_STRIP[g][0][9] == 0;
+        ok_strip &= ASCII_BIG_STRIP[g][1][0] == 0 && ASCII_BIG_STRIP[g][1][9] == 0;
+        for(i = 0; i < 8; i++){
+            ok_strip &= ASCII_BIG_STRIP[g][0][1 + i] == (uint8_t)ASCII_BIG[g][i][0];
+            ok_strip &= ASCII_BIG_STRIP[g][1][1 + i] == (uint8_t)ASCII_BIG[g][i][1];
+        }
+
+        log_rewind();
+        LCD_print_bigchar(g % 8, 1, (char)(0x20 + g));
+        run_flush(host_spi_count);
+        upper = 2 * LCD_COLS + (g % 8) * 10;
+        ok_fb &= fb[upper] == 0 && fb[upper + LCD_COLS] == 0;
+        ok_fb &= fb[upper + 9] == 0 && fb[upper + LCD_COLS + 9] == 0;
+        for(i = 0; i < 8; i++){
+            ok_fb &= fb[upper + 1 + i] == (uint8_t)ASCII_BIG[g][i][0];
+            ok_fb &= fb[upper + LCD_COLS + 1 + i] == (uint8_t)ASCII_BIG[g][i][1];
+        }
+    }
+    CHECK(ok_strip, "strips match ASCII_BIG");
+    CHECK(ok_fb, "big characters rendered from the strips");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after big characters");
+
+    LCD_print_bigstr(0, 0, "0123");
+    run_flush(host_spi_count);
+    start = host_spi_count;
+    LCD_print_bigstr(0, 0, "0123");
+    CHECK(run_flush(start) == 0, "unchanged big digits send nothing");
+}
+
+//
+// Decimal routines draw the formatted string in one flush
+//
+static void test_decimal(void){
+    uint8_t *fb = LCD_framebuffer();
+    uint32_t start;
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    LCD_goto_xy(0, 3);
+    LCD_print_str("- 45 65535");
+    run_flush(host_spi_count);
+
+    start = transactions();
+    LCD_goto_xy(0, 2);
+    LCD_print_dec3(-45);
+    LCD_print_char(' ');
+    LCD_print_udec5(65535);
+    run_flush(host_spi_count);
+    CHECK(memcmp(&fb[2 * LCD_COLS], &fb[3 * LCD_COLS], 10 * 7) == 0, "decimal text");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after decimal print");
+    CHECK(transactions() - start < 2 * 4 + 2 + 7 + 2, "one run per number");
+}
+
+static void test_callback(void){
+    flush_done = 0;
+    LCD_flush_callback(flush_cb);
+    LCD_fb_dirty(0, 0, LCD_COLS - 1);
+    LCD_flush();
+    CHECK(flush_done == 0, "callback not before completion");
+    host_dma_run(TEST_DMA_CH);
+    CHECK(flush_done == 1, "callback on completion");
+    LCD_flush();                        // nothing dirty
+    CHECK(flush_done == 2, "callback when there is nothing to send");
+    LCD_flush_callback(0);
+}
+
+//
+// Run length encoded bitmaps
+//
+// The committed header must match a fresh encode of the bitmap and decode
+// back to it through LCD_print_bmpRLE
+//
+static void check_rle(const char *bmp, const uint8_t *rle, uint32_t rle_size, const char *name){
+    uint8_t enc[LCD_FB_SIZE + LCD_FB_SIZE / BMP_RLE_LIT_MAX + 1];
+    uint32_t start;
+
+    CHECK(bmp_rle_encode((const uint8_t *)bmp, LCD_FB_SIZE, enc) == rle_size
+          && memcmp(enc, rle, rle_size) == 0, "RLE header matches the generator");
+
+    LCD_clear();
+    run_flush(host_spi_count);
+    log_rewind();
+    LCD_print_bmpRLE(rle);
+    run_flush(0);
+    CHECK(memcmp(ddram, bmp, LCD_FB_SIZE) == 0, name);
+    CHECK(memcmp(LCD_framebuffer(), bmp, LCD_FB_SIZE) == 0, name);
+    printf("  %-10s %3u flash bytes (%u raw)\n", name, (unsigned)rle_size, LCD_FB_SIZE);
+
+    start = host_spi_count;
+    LCD_print_bmpArray(bmp);            // same picture - nothing to send
+    CHECK(run_flush(start) == 0, "RLE decode leaves nothing dirty");
+}
+
+//
+// Encoder packet boundaries - runs of 1 to 131, long literals, runs across banks
+//
+static void test_rle_patterns(void){
+    static uint8_t bmp[LCD_FB_SIZE];
+    uint8_t enc[LCD_FB_SIZE + LCD_FB_SIZE / BMP_RLE_LIT_MAX + 1];
+    uint32_t pattern;
+    uint32_t seed = 12345;
+    uint32_t i;
+    uint32_t run;
+    uint32_t len;
+    int ok = 1;
+
+    for(pattern = 0; pattern < 5; pattern++){
+        for(i = 0, run = 0, len = 0; i < LCD_FB_SIZE; i++){
+            seed = seed * 1103515245 + 12345;
+            switch(pattern){
+            case 0: bmp[i] = 0x00; break;                           // one value
+            case 1: bmp[i] = (uint8_t)(seed >> 16); break;          // no runs
+            case 2: bmp[i] = (i & 1) ? 0x55 : 0xAA; break;          // checkerboard
+            case 3: bmp[i] = (uint8_t)(i % 130); break;             // 130 byte literals
+            default:                                                // runs of 1, 2, 3 ...
+                if(len == run){
+                    run++;
+                    len = 0;
+                }
+                bmp[i] = (uint8_t)run;
+                len++;
+                break;
+            }
+        }
+        LCD_clear();
+        run_flush(host_spi_count);
+        log_rewind();
+        bmp_rle_encode(bmp, LCD_FB_SIZE, enc);
+        LCD_print_bmpRLE(enc);
+        run_flush(0);
+        ok &= memcmp(LCD_framebuffer(), bmp, LCD_FB_SIZE) == 0;
+        ok &= memcmp(ddram, bmp, LCD_FB_SIZE) == 0;
+    }
+    CHECK(ok, "RLE round trip of edge patterns");
+}
+
+//
+// Sprite blit
+//
+// Random sprites, positions (including clipped ones), strides and modes
+// against a per pixel reference on a copy of the framebuffer
+//
+static int ref_pixel(const uint8_t *buf, int stride, int x, int y){
+    return (buf[(y >> 3) * stride + x] >> (y & 7)) & 1;
+}
+
+static void ref_blit(uint8_t *fb, int x, int y, const uint8_t *sprite, int w, int h, int stride, int mode){
+    int sx;
+    int sy;
+    int px;
+    int dx;
+    int dy;
+
+    for(sy = 0; sy < h; sy++){
+        for(sx = 0; sx < w; sx++){
+            dx = x + sx;
+            dy = y + sy;
+            if(dx < 0 || dx >= LCD_COLS || dy < 0 || dy >= LCD_BANKS * 8)
+                continue;
+            px = ref_pixel(sprite, stride, sx, sy);
+            if(mode == LCD_BLIT_OR)
+                px |= ref_pixel(fb, LCD_COLS, dx, dy);
+            else if(mode == LCD_BLIT_XOR)
+                px ^= ref_pixel(fb, LCD_COLS, dx, dy);
+            fb[(dy >> 3) * LCD_COLS + dx] &= (uint8_t)~(1 << (dy & 7));
+            fb[(dy >> 3) * LCD_COLS + dx] |= (uint8_t)(px << (dy & 7));
+        }
+    }
+}
+
+static void test_blit(void){
+    static uint8_t sprite[8 * 40];
+    static uint8_t ref[LCD_FB_SIZE];
+    uint8_t *fb = LCD_framebuffer();
+    uint32_t seed = 777;
+    uint32_t trial;
+    uint32_t i;
+    uint32_t start;
+    int x, y, w, h, stride, mode;
+    int ok = 1;
+
+    LCD_print_bmpArray(bat1);
+    run_flush(host_spi_count);
+    for(trial = 0; trial < 2000; trial++){
+        seed = seed * 1103515245 + 12345;
+        w = 1 + (seed >> 8) % 40;
+        h = 1 + (seed >> 16) % 30;
+        seed = seed * 1103515245 + 12345;
+        x = (int)((seed >> 8) % 130) - 40;
+        y = (int)((seed >> 16) % 90) - 35;
+        mode = (seed >> 28) % 3;
+        stride = w + (int)(trial % 3);
+        for(i = 0; i < sizeof(sprite); i++){
+            seed = seed * 1103515245 + 12345;
+            sprite[i] = (uint8_t)(seed >> 20);
+        }
+        memcpy(ref, fb, LCD_FB_SIZE);
+        ref_blit(ref, x, y, sprite, w, h, stride, mode);
+        log_rewind();
+        LCD_blit((int16_t)x, (int16_t)y, sprite, (uint8_t)w, (uint8_t)h, (uint8_t)stride, (uint8_t)mode);
+        run_flush(0);
+        ok &= memcmp(fb, ref, LCD_FB_SIZE) == 0;
+        ok &= memcmp(ddram, ref, LCD_FB_SIZE) == 0;
+    }
+    CHECK(ok, "blit matches the per pixel reference");
+
+    // battery icon from bat1 next to the speed - only its columns are sent
+    LCD_clear();
+    run_flush(host_spi_count);
+    log_rewind();
+    LCD_blit(60, 3, (const uint8_t *)&bat1[LCD_COLS + 30], 24, 16, LCD_COLS, LCD_BLIT_OVERWRITE);
+    CHECK(run_flush(0) <= 3 * (2 + 24), "icon sends only its columns");
+    CHECK(memcmp(ddram, fb, LCD_FB_SIZE) == 0, "display matches after icon blit");
+
+    start = host_spi_count;
+    LCD_blit(60, 3, (const uint8_t *)&bat1[LCD_COLS + 30], 24, 16, LCD_COLS, LCD_BLIT_OR);
+    CHECK(run_flush(start) == 0, "OR of the same icon sends nothing");
+    LCD_blit(60, 3, (const uint8_t *)&bat1[LCD_COLS + 30], 24, 16, LCD_COLS, LCD_BLIT_XOR);
+    LCD_blit(60, 3, (const uint8_t *)&bat1[LCD_COLS + 30], 24, 16, LCD_COLS, LCD_BLIT_XOR);
+    run_flush(start);
+    memset(ref, 0, LCD_FB_SIZE);
+    ref_blit(ref, 60, 3, (const uint8_t *)&bat1[LCD_COLS + 30], 24, 16, LCD_COLS, LCD_BLIT_OVERWRITE);
+    CHECK(memcmp(fb, ref, LCD_FB_SIZE) == 0, "XOR twice restores the display");
+}
+
+int main(void){
+    host_dc_port = TEST_DC_PORT;
+    host_dc_mask = TEST_DC_PIN;
+    test_config();
+    check_bmp(pu1, "pu1");
+    check_bmp(msoe1, "msoe1");
+    check_bmp(bat1, "bat1");
+    check_bmp(test_bmp, "test_bmp");
+    check_rle(pu1, pu1_rle, sizeof(pu1_rle), "pu1");
+    check_rle(msoe1, msoe1_rle, sizeof(msoe1_rle), "msoe1");
+    check_rle(bat1, bat1_rle, sizeof(bat1_rle), "bat1");
+    check_rle(test_bmp, test_bmp_rle, sizeof(test_bmp_rle), "test_bmp");
+    test_rle_patterns();
+    test_shadow();
+    test_incremental();
+    test_queue();
+    test_queue_flush_addr();
+    test_tick_print();
+    test_batch();
+    test_bigfont();
+    test_blit();
+    test_decimal();
+    test_callback();
+
+    return host_test_end("lcd_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
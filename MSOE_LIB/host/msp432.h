@@ -0,0 +1,358 @@
+/*
+ * msp432.h  (host build)
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     host stand-in for the TI device header
+ *      Rev:    0.2     SysTick registers
+ *      Rev:    0.3     TIMER_A, SCB, PCM registers and WFI
+ *      Rev:    0.4     counting SysTick, CS / FLCTL / PJ registers
+ *      Rev:    0.5     DWT cycle counter on clock_gettime
+ *      Rev:    0.6     CS interrupt number
+ *      Rev:    0.7     PCM current mode can follow the request
+ *      Rev:    0.8     TIMER_A1 overflow interrupt number
+ *      Rev:    0.9     IPSR / PRIMASK, DMA transfers that finish when polled
+ *
+ */
+#ifndef __MSOE_LIB_HOST_MSP432_H__
+#define __MSOE_LIB_HOST_MSP432_H__
+////////////////////////////////////////////
+//
+// Host (Linux) stand-in for the TI msp432.h device header
+//
+// The library sources include "msp432.h". Putting this directory first on
+// the include path (gcc -I host ...) builds them against plain RAM register
+// blocks instead of the MSP432 peripherals so the driver logic can be
+// exercised on a PC.
+//
+// Only the registers used by MSOE_LIB are modeled.
+//
+// eUSCI model
+//      TXIFG is always set and the shifter is never busy
+//      every byte loaded into TXBUF is captured, along with the level of
+//      the D/C pin (host_dc_port / host_dc_mask) at the time it left TXBUF
+//      interrupts are not raised - a test calls the handler while IE is set
+//
+// DMA model
+//      host_dma_run() performs the transfer programmed in the primary
+//      control structure of a channel and then calls the INT1 handler
+//      INT0_CLRFLG clears INT0_SRCFLG bits (applied at the next access)
+//      with host_dma_poll set, any DMA_Channel access finishes the armed
+//      transfers and sets their INT0_SRCFLG bits - the interrupt is left
+//      pending (not called), as it is for code polling with it masked
+//
+// Core registers
+//      __get_IPSR() / __get_PRIMASK() read host_ipsr / host_primask - a test
+//      sets them around a call to play a handler or interrupts off
+//
+// SysTick model
+//      every SysTick register access is one CPU clock - while enabled the
+//      counter runs down from LOAD, sets COUNTFLAG on 1 -> 0 (cleared by the
+//      next access, as a CTRL read would) and reloads
+//      host_systick_clocks counts the clocks that passed while enabled
+//      the interrupt is not raised - a test calls SysTick_Handler for a tick
+//
+// CS, FLCTL, PJ model
+//      registers only - preset CS->STAT / PCM->CTL0 for the clock routines
+//
+// DWT model
+//      while CoreDebug DEMCR TRCENA and DWT CTRL CYCCNTENA are set, every
+//      DWT access loads CYCCNT from host_dwt_clock - by default
+//      CLOCK_MONOTONIC in ns (a 1GHz "CPU"), a test may install its own
+//
+// TIMER_A, SCB, PCM model
+//      registers only
+//      with host_pcm_follow set, any PCM access after a power mode request
+//      finds the current mode (CPM) already there - the transition is done
+//      __WFI() calls host_wfi_hook (if set) - a test uses it to play the
+//      interrupt that ends the sleep
+//
+// SPI transactions (CPU writes to TXBUF + DMA bursts) are
+//      host_spi_count - host_spi_dma_bytes + host_spi_dma_bursts
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include <stddef.h>
+
+////////////////////////////////////////////
+//
+// Bit helpers
+//
+////////////////////////////////////////////
+#define BIT(x)      ((uint16_t)1 << (x))
+#define BIT0        (0x0001)
+#define BIT1        (0x0002)
+#define BIT2        (0x0004)
+#define BIT3        (0x0008)
+#define BIT4        (0x0010)
+#define BIT5        (0x0020)
+#define BIT6        (0x0040)
+#define BIT7        (0x0080)
+
+////////////////////////////////////////////
+//
+// Register blocks
+//
+////////////////////////////////////////////
+typedef struct {
+    volatile uint16_t CTLW0;
+    volatile uint16_t CTLW1;
+    volatile uint16_t BRW;
+    volatile uint16_t MCTLW;
+    volatile uint16_t STATW;
+    volatile uint16_t RXBUF;
+    volatile uint16_t TXBUF;
+    volatile uint16_t ABCTL;
+    volatile uint16_t IRCTL;
+    volatile uint16_t IE;
+    volatile uint16_t IFG;
+    volatile uint16_t IV;
+} EUSCI_A_Type;
+
+typedef struct {
+    volatile uint8_t IN;
+    volatile uint8_t OUT;
+    volatile uint8_t DIR;
+    volatile uint8_t REN;
+    volatile uint8_t DS;
+    volatile uint8_t SEL0;
+    volatile uint8_t SEL1;
+    volatile uint8_t IV;
+    volatile uint8_t SELC;
+    volatile uint8_t IES;
+    volatile uint8_t IE;
+    volatile uint8_t IFG;
+} DIO_PORT_Type;
+
+typedef struct {
+    volatile uint32_t STAT;
+    volatile uint32_t CFG;
+    volatile uintptr_t CTLBASE;     // pointer sized so the host can hold a table address
+    volatile uint32_t ALTBASE;
+    volatile uint32_t WAITSTAT;
+    volatile uint32_t SWREQ;
+    volatile uint32_t USEBURSTSET;
+    volatile uint32_t USEBURSTCLR;
+    volatile uint32_t REQMASKSET;
+    volatile uint32_t REQMASKCLR;
+    volatile uint32_t ENASET;
+    volatile uint32_t ENACLR;
+    volatile uint32_t ALTSET;
+    volatile uint32_t ALTCLR;
+    volatile uint32_t PRIOSET;
+    volatile uint32_t PRIOCLR;
+    volatile uint32_t ERRCLR;
+} DMA_Control_Type;
+
+typedef struct {
+    volatile uint32_t DEVICE_CFG;
+    volatile uint32_t SW_CHTRIG;
+    volatile uint32_t CH_SRCCFG[32];
+    volatile uint32_t INT1_SRCCFG;
+    volatile uint32_t INT2_SRCCFG;
+    volatile uint32_t INT3_SRCCFG;
+    volatile uint32_t INT0_SRCFLG;
+    volatile uint32_t INT0_CLRFLG;
+} DMA_Channel_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+    volatile uint16_t CTL;
+    volatile uint16_t CCTL[7];
+    volatile uint16_t R;
+    volatile uint16_t CCR[7];
+    volatile uint16_t EX0;
+    volatile uint16_t IV;
+} Timer_A_Type;
+
+typedef struct {
+    volatile uint32_t KEY;
+    volatile uint32_t CTL0;
+    volatile uint32_t CTL1;
+    volatile uint32_t CTL2;
+    volatile uint32_t CTL3;
+    volatile uint32_t CLKEN;
+    volatile uint32_t STAT;
+    volatile uint32_t IE;
+    volatile uint32_t IFG;
+    volatile uint32_t CLRIFG;
+    volatile uint32_t SETIFG;
+} CS_Type;
+
+typedef struct {
+    volatile uint32_t POWER_STAT;
+    volatile uint32_t BANK0_RDCTL;
+    volatile uint32_t BANK1_RDCTL;
+} FLCTL_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DHCSR;
+    volatile uint32_t DCRSR;
+    volatile uint32_t DCRDR;
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    volatile uint32_t CPUID;
+    volatile uint32_t ICSR;
+    volatile uint32_t VTOR;
+    volatile uint32_t AIRCR;
+    volatile uint32_t SCR;
+    volatile uint32_t CCR;
+} SCB_Type;
+
+typedef struct {
+    volatile uint32_t CTL0;
+    volatile uint32_t CTL1;
+    volatile uint32_t IE;
+    volatile uint32_t IFG;
+    volatile uint32_t CLRIFG;
+} PCM_Type;
+
+typedef struct {
+    volatile uint32_t ISER[2];
+    volatile uint32_t ICER[2];
+    volatile uint32_t ISPR[2];
+    volatile uint32_t ICPR[2];
+    volatile uint8_t IP[64];
+} NVIC_Type;
+
+////////////////////////////////////////////
+//
+// Register instances
+//
+////////////////////////////////////////////
+extern EUSCI_A_Type host_eusci_a1;
+extern EUSCI_A_Type host_eusci_a3;
+extern DIO_PORT_Type host_port[11];     // index 1-10 used
+extern DMA_Control_Type host_dma_control;
+extern DMA_Channel_Type host_dma_channel;
+extern uint8_t host_dma_poll;           // DMA_Channel access finishes armed transfers
+extern NVIC_Type host_nvic;
+extern SysTick_Type host_systick;
+extern uint64_t host_systick_clocks;    // clocks counted while SysTick was enabled
+extern CS_Type host_cs;
+extern FLCTL_Type host_flctl;
+extern DIO_PORT_Type host_pj;
+extern Timer_A_Type host_timer_a[4];
+extern SCB_Type host_scb;
+extern PCM_Type host_pcm;
+extern uint8_t host_pcm_follow;        // CPM follows AMR
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_coredebug;
+extern uint32_t (*host_dwt_clock)(void);    // CYCCNT source
+
+EUSCI_A_Type *host_eusci(EUSCI_A_Type *inst);
+SysTick_Type *host_systick_access(void);
+DWT_Type *host_dwt_access(void);
+PCM_Type *host_pcm_access(void);
+DMA_Channel_Type *host_dma_access(void);
+uint32_t host_dwt_ns(void);             // default host_dwt_clock
+
+#define EUSCI_A1        (host_eusci(&host_eusci_a1))
+#define EUSCI_A3        (host_eusci(&host_eusci_a3))
+#define P1              (&host_port[1])
+#define P2              (&host_port[2])
+#define P3              (&host_port[3])
+#define P4              (&host_port[4])
+#define P5              (&host_port[5])
+#define P6              (&host_port[6])
+#define P7              (&host_port[7])
+#define P8              (&host_port[8])
+#define P9              (&host_port[9])
+#define P10             (&host_port[10])
+#define DMA_Control     (&host_dma_control)
+#define DMA_Channel     (host_dma_access())
+#define NVIC            (&host_nvic)
+#define SysTick         (host_systick_access())
+#define CS              (&host_cs)
+#define FLCTL           (&host_flctl)
+#define PJ              (&host_pj)
+#define TIMER_A0        (&host_timer_a[0])
+#define TIMER_A1        (&host_timer_a[1])
+#define TIMER_A2        (&host_timer_a[2])
+#define TIMER_A3        (&host_timer_a[3])
+#define SCB             (&host_scb)
+#define PCM             (host_pcm_access())
+#define DWT             (host_dwt_access())
+#define CoreDebug       (&host_coredebug)
+
+#define CS_IRQn         (1)
+#define TA0_0_IRQn      (8)
+#define TA1_0_IRQn      (10)
+#define TA1_N_IRQn      (11)
+#define TA2_0_IRQn      (12)
+#define TA2_N_IRQn      (13)
+#define TA3_0_IRQn      (14)
+#define EUSCIA1_IRQn    (17)
+#define EUSCIA3_IRQn    (19)
+#define DMA_INT1_IRQn   (31)
+
+////////////////////////////////////////////
+//
+// Intrinsics
+//
+////////////////////////////////////////////
+#define __disable_irq()         ((void)0)
+#define __enable_irq()          ((void)0)
+#define _enable_interrupts()    (0U)
+#define _disable_interrupts()   (0U)
+#define _restore_interrupts(x)  ((void)(x))
+#define __WFI()                 host_wfi()
+#define __get_IPSR()            (host_ipsr)
+#define __get_PRIMASK()         (host_primask)
+
+extern uint32_t host_ipsr;              // exception number - 0 thread mode
+extern uint32_t host_primask;           // 1 - interrupts off
+
+//
+// Called by __WFI() - NULL returns at once (as if any interrupt woke the CPU)
+//
+extern void (*host_wfi_hook)(void);
+void host_wfi(void);
+
+////////////////////////////////////////////
+//
+// Host side capture of the SPI byte stream
+//
+////////////////////////////////////////////
+#define HOST_SPI_LOG_SIZE   4096
+
+typedef struct {
+    uint8_t data;
+    uint8_t dc;         // D/C level - 1 = data, 0 = command
+} host_spi_byte_t;
+
+extern host_spi_byte_t host_spi_log[HOST_SPI_LOG_SIZE];
+extern uint32_t host_spi_count;         // bytes captured since the last reset
+extern uint32_t host_spi_dma_bytes;     // bytes of host_spi_count moved by the DMA
+extern uint32_t host_spi_dma_bursts;    // DMA transfers run
+extern DIO_PORT_Type *host_dc_port;     // D/C pin sampled for each captured byte
+extern uint8_t host_dc_mask;
+
+//
+// Clear the capture log and the register blocks
+//
+void host_reset(void);
+
+//
+// Run the DMA transfer armed on a channel and raise its completion interrupt
+//
+// Returns the number of bytes moved (0 if the channel was not enabled)
+//
+uint32_t host_dma_run(uint8_t channel);
+
+#endif // __MSOE_LIB_HOST_MSP432_H__
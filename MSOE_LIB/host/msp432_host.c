@@ -0,0 +1,241 @@
+/*
+ * msp432_host.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     host stand-in for the MSP432 peripherals
+ *      Rev:    0.2     SysTick registers
+ *      Rev:    0.3     TIMER_A, SCB, PCM registers and WFI
+ *      Rev:    0.4     counting SysTick, CS / FLCTL / PJ registers
+ *      Rev:    0.5     DWT cycle counter on clock_gettime
+ *      Rev:    0.7     PCM current mode can follow the request
+ *      Rev:    0.9     IPSR / PRIMASK, DMA transfers that finish when polled
+ *
+ */
+#if !defined(__TI_COMPILER_VERSION__)
+////////////////////////////////////////////
+//
+// Host register model - see host/msp432.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#define _POSIX_C_SOURCE 199309L     // clock_gettime with -std=c99
+#include <string.h>
+#include <time.h>
+#include "msp432.h"
+
+//
+// DMA control structure - same layout the drivers use
+//
+typedef struct {
+    const volatile void *src_end;
+    volatile void *dst_end;
+    uint32_t ctl;
+    uint32_t spare;
+} host_dma_ctl_t;
+
+EUSCI_A_Type host_eusci_a1;
+EUSCI_A_Type host_eusci_a3;
+DIO_PORT_Type host_port[11];
+DMA_Control_Type host_dma_control;
+DMA_Channel_Type host_dma_channel;
+uint8_t host_dma_poll = 0;
+NVIC_Type host_nvic;
+SysTick_Type host_systick;
+uint64_t host_systick_clocks;
+CS_Type host_cs;
+FLCTL_Type host_flctl;
+DIO_PORT_Type host_pj;
+Timer_A_Type host_timer_a[4];
+SCB_Type host_scb;
+PCM_Type host_pcm;
+uint8_t host_pcm_follow = 0;
+DWT_Type host_dwt;
+CoreDebug_Type host_coredebug;
+uint32_t (*host_dwt_clock)(void) = host_dwt_ns;
+void (*host_wfi_hook)(void) = NULL;
+uint32_t host_ipsr = 0;
+uint32_t host_primask = 0;
+
+host_spi_byte_t host_spi_log[HOST_SPI_LOG_SIZE];
+uint32_t host_spi_count;
+uint32_t host_spi_dma_bytes;
+uint32_t host_spi_dma_bursts;
+DIO_PORT_Type *host_dc_port = &host_port[9];
+uint8_t host_dc_mask = 0x04;
+
+#define HOST_TXBUF_EMPTY    0xFFFF      // no byte waiting to be captured
+
+//
+// Weak default so tests that do not link a DMA user still build
+//
+void __attribute__((weak)) DMA_INT1_IRQHandler(void){
+}
+
+//
+// Capture a byte left in TXBUF by the previous access
+//
+static void host_capture(EUSCI_A_Type *inst){
+    if(inst->TXBUF != HOST_TXBUF_EMPTY){
+        if(host_spi_count < HOST_SPI_LOG_SIZE){
+            host_spi_log[host_spi_count].data = (uint8_t)inst->TXBUF;
+            host_spi_log[host_spi_count].dc = (host_dc_port->OUT & host_dc_mask) != 0;
+        }
+        host_spi_count++;
+        inst->TXBUF = HOST_TXBUF_EMPTY;
+    }
+}
+
+//
+// Every EUSCI_Ax register access goes through here
+//
+EUSCI_A_Type *host_eusci(EUSCI_A_Type *inst){
+    host_capture(inst);
+    inst->IFG |= 0x0002;                // TX buffer is always ready
+    inst->STATW &= ~0x0001;             // never busy
+    return inst;
+}
+
+//
+// Every SysTick register access is one clock of the counter
+// VAL 0 (after reset or a write) loads LOAD on the next clock
+//
+SysTick_Type *host_systick_access(void){
+    SysTick_Type *st = &host_systick;
+    st->CTRL &= ~0x00010000UL;          // the previous access read COUNTFLAG
+    if(st->CTRL & 0x0001){
+        host_systick_clocks++;
+        if(st->VAL == 0)
+            st->VAL = st->LOAD & 0x00FFFFFF;
+        else if(--st->VAL == 0)
+            st->CTRL |= 0x00010000UL;
+    }
+    return st;
+}
+
+//
+// CYCCNT follows host_dwt_clock while the counter is enabled
+//
+DWT_Type *host_dwt_access(void){
+    if((host_coredebug.DEMCR & 0x01000000) && (host_dwt.CTRL & 0x0001))
+        host_dwt.CYCCNT = host_dwt_clock();
+    return &host_dwt;
+}
+
+//
+// CPM (bits 13:8) takes the requested mode (AMR bits 3:0)
+//
+PCM_Type *host_pcm_access(void){
+    if(host_pcm_follow)
+        host_pcm.CTL0 = (host_pcm.CTL0 & ~0x00003F00) | ((host_pcm.CTL0 & 0x0000000F) << 8);
+    return &host_pcm;
+}
+
+uint32_t host_dwt_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+void host_reset(void){
+    memset(&host_eusci_a1, 0, sizeof(host_eusci_a1));
+    memset(&host_eusci_a3, 0, sizeof(host_eusci_a3));
+    memset(host_port, 0, sizeof(host_port));
+    memset(&host_dma_control, 0, sizeof(host_dma_control));
+    memset(&host_dma_channel, 0, sizeof(host_dma_channel));
+    memset(&host_nvic, 0, sizeof(host_nvic));
+    memset(&host_systick, 0, sizeof(host_systick));
+    host_systick_clocks = 0;
+    memset(&host_cs, 0, sizeof(host_cs));
+    memset(&host_flctl, 0, sizeof(host_flctl));
+    memset(&host_pj, 0, sizeof(host_pj));
+    memset(host_timer_a, 0, sizeof(host_timer_a));
+    memset(&host_scb, 0, sizeof(host_scb));
+    memset(&host_pcm, 0, sizeof(host_pcm));
+    host_pcm_follow = 0;
+    host_dma_poll = 0;
+    host_ipsr = 0;
+    host_primask = 0;
+    memset(&host_dwt, 0, sizeof(host_dwt));
+    memset(&host_coredebug, 0, sizeof(host_coredebug));
+    host_eusci_a1.TXBUF = HOST_TXBUF_EMPTY;
+    host_eusci_a3.TXBUF = HOST_TXBUF_EMPTY;
+    host_spi_count = 0;
+    host_spi_dma_bytes = 0;
+    host_spi_dma_bursts = 0;
+}
+
+void host_wfi(void){
+    if(host_wfi_hook != NULL)
+        host_wfi_hook();
+}
+
+//
+// A write to INT0_CLRFLG clears its flags by the next access
+//
+static void host_dma_clear(void){
+    host_dma_channel.INT0_SRCFLG &= ~host_dma_channel.INT0_CLRFLG;
+    host_dma_channel.INT0_CLRFLG = 0;
+}
+
+//
+// Moves the bytes of the transfer armed on a channel and sets its done flag
+// Returns the number of bytes moved (0 if the channel was not enabled)
+//
+static uint32_t host_dma_move(uint8_t channel){
+    host_dma_ctl_t *table = (host_dma_ctl_t *)host_dma_control.CTLBASE;
+    host_dma_ctl_t *ctl;
+    const volatile uint8_t *src;
+    EUSCI_A_Type *inst;
+    uint32_t n;
+    uint32_t i;
+
+    if(table == NULL || !(host_dma_control.ENASET & (1UL << channel)))
+        return 0;
+    ctl = &table[channel];
+    if((ctl->ctl & 0x7) == 0)           // stop - nothing armed
+        return 0;
+
+    n = ((ctl->ctl >> 4) & 0x3FF) + 1;
+    src = (const volatile uint8_t *)ctl->src_end - (n - 1);
+    inst = (EUSCI_A_Type *)((char *)ctl->dst_end - offsetof(EUSCI_A_Type, TXBUF));
+
+    host_capture(inst);                 // byte loaded by hand ahead of the channel
+    for(i = 0; i < n; i++){
+        inst->TXBUF = src[i];
+        host_capture(inst);
+    }
+
+    host_spi_dma_bytes += n;
+    host_spi_dma_bursts++;
+
+    ctl->ctl &= ~0x7;                   // basic mode ends in stop
+    host_dma_control.ENASET &= ~(1UL << channel);
+    host_dma_clear();
+    host_dma_channel.INT0_SRCFLG |= (1UL << channel);
+    return n;
+}
+
+uint32_t host_dma_run(uint8_t channel){
+    uint32_t n = host_dma_move(channel);
+
+    if(n && (host_dma_channel.INT1_SRCCFG & 0x20) && (host_dma_channel.INT1_SRCCFG & 0x1F) == channel)
+        DMA_INT1_IRQHandler();
+    return n;
+}
+
+//
+// Every DMA_Channel access goes through here
+//
+DMA_Channel_Type *host_dma_access(void){
+    uint8_t ch;
+
+    host_dma_clear();
+    if(host_dma_poll)
+        for(ch = 0; ch < 8; ch++)
+            host_dma_move(ch);
+    return &host_dma_channel;
+}
+
+#endif // !__TI_COMPILER_VERSION__
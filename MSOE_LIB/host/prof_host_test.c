@@ -0,0 +1,220 @@
+/*
+ * prof_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     profiling statistics, histogram, dump and the host clock
+ *      Rev:    0.2     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_prof - a scripted cycle counter checks the
+ *  statistics exactly, then the clock_gettime counter is checked against
+ *  a known sleep
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o prof_host_test host/prof_host_test.c msoe_lib_prof.c msoe_lib_fmt.c host/msp432_host.c
+ *      ./prof_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#define _POSIX_C_SOURCE 199309L     // nanosleep with -std=c99
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_prof.h"
+
+//
+// Scripted cycle counter - each read moves it on by fake_step
+//
+static uint32_t fake_now;
+static uint32_t fake_step;
+
+static uint32_t fake_clock(void){
+    fake_now += fake_step;
+    return fake_now;
+}
+
+//
+// Dump capture
+//
+#define LINES   16
+static char lines[LINES][PROF_LINE];
+static int nlines;
+
+static void capture(const char *line){
+    if(nlines < LINES)
+        strcpy(lines[nlines], line);
+    nlines++;
+}
+
+static void test_stats(void){
+    static const uint32_t len[] = {50, 3, 4, 15, 16, 1000, 70000, 0};
+    Prof_stats_t st;
+    int8_t a;
+    int8_t b;
+    uint32_t t;
+    uint32_t i;
+
+    host_reset();
+    host_dwt_clock = fake_clock;
+    fake_now = 0;
+    fake_step = 0;
+    Prof_Init();
+    CHECK(CoreDebug->DEMCR & 0x01000000, "TRCENA set");
+    CHECK(DWT->CTRL & 0x0001, "CYCCNT running");
+
+    a = Prof_section("isr");
+    b = Prof_section("lcd");
+    CHECK(a == 0 && b == 1, "sections numbered in order");
+    CHECK(Prof_section("isr") == a, "same name, same section");
+
+    for(i = 0; i < sizeof(len) / sizeof(len[0]); i++){
+        t = Prof_begin();
+        fake_now += len[i];
+        Prof_end(a, t);
+    }
+    Prof_get(a, &st);
+    CHECK(st.count == 8, "count");
+    CHECK(st.min == 0 && st.max == 70000, "min / max");
+    CHECK(st.total == 50 + 3 + 4 + 15 + 16 + 1000 + 70000, "total");
+    CHECK(st.hist[0] == 2 && st.hist[1] == 2 && st.hist[2] == 2
+          && st.hist[4] == 1 && st.hist[8] == 1, "histogram by powers of 4");
+    CHECK(strcmp(st.name, "isr") == 0, "name kept");
+
+    fake_now = 0xFFFFFFF0;              // CYCCNT wraps inside the section
+    PROF_SCOPE(b){
+        fake_now += 0x30;
+    }
+    Prof_get(b, &st);
+    CHECK(st.count == 1 && st.min == 0x30, "PROF_SCOPE across a CYCCNT wrap");
+
+    Prof_end(-1, 0);
+    Prof_end(PROF_MAX, 0);
+    Prof_get(5, &st);
+    CHECK(st.count == 0 && st.name == 0, "unused section reads 0");
+
+    Prof_clear();
+    Prof_get(a, &st);
+    CHECK(st.count == 0 && st.max == 0 && st.hist[0] == 0, "cleared");
+    CHECK(strcmp(st.name, "isr") == 0, "clear keeps the name");
+    CHECK(Prof_section("adc") == 2, "next name gets the next section");
+}
+
+//
+// Begin / end overhead taken off by Prof_Init's calibration
+//
+static void test_overhead(void){
+    Prof_stats_t st;
+    int8_t a;
+    uint32_t t;
+
+    host_reset();
+    host_dwt_clock = fake_clock;
+    fake_now = 1000;
+    fake_step = 7;                      // each CYCCNT read costs 7 clocks
+    Prof_Init();
+    a = Prof_section("empty");
+    t = Prof_begin();
+    Prof_end(a, t);
+    t = Prof_begin();
+    fake_now += 100;
+    Prof_end(a, t);
+    Prof_get(a, &st);
+    CHECK(st.min == 0 && st.max == 100, "overhead taken off");
+}
+
+static void test_pool(void){
+    char name[PROF_MAX + 1][8];
+    int i;
+    int ok = 1;
+
+    host_reset();
+    host_dwt_clock = fake_clock;
+    fake_step = 0;
+    Prof_Init();
+    for(i = 0; i <= PROF_MAX; i++){
+        sprintf(name[i], "s%d", i);
+        ok &= Prof_section(name[i]) == (i < PROF_MAX ? i : -1);
+    }
+    CHECK(ok, "PROF_MAX sections, then -1");
+}
+
+static void test_dump(void){
+    int8_t a;
+    int8_t b;
+    uint32_t t;
+    uint32_t i;
+
+    host_reset();
+    host_dwt_clock = fake_clock;
+    fake_now = 0;
+    fake_step = 0;
+    Prof_Init();
+    a = Prof_section("PORT6_IRQHandler");
+    b = Prof_section("idle");
+    for(i = 1; i <= 4; i++){
+        t = Prof_begin();
+        fake_now += i * 100;
+        Prof_end(a, t);
+    }
+    t = Prof_begin();
+    fake_now += 12345678;
+    Prof_end(a, t);
+    (void)b;
+
+    nlines = 0;
+    Prof_dump(capture, 0);
+    CHECK(nlines == 5, "wide - header and 2 lines per section");
+    CHECK(strcmp(lines[0], "section        count       min       max      mean") == 0, "header");
+    CHECK(strcmp(lines[1], "PORT6_IRQH         5       100  12345678   2469335") == 0, "section line");
+    CHECK(strcmp(lines[2], "  hist 0 0 0 2 2 0 0 0 0 0 0 1") == 0, "histogram line");
+    CHECK(strcmp(lines[3], "idle               0         0         0         0") == 0, "empty section");
+    CHECK(strcmp(lines[4], "  hist 0") == 0, "empty histogram");
+
+    nlines = 0;
+    Prof_dump(capture, 1);
+    CHECK(nlines == 4, "narrow - 2 lines per section");
+    CHECK(strcmp(lines[0], "PORT6_IRQHandl") == 0, "name cut to 14");
+    CHECK(strcmp(lines[1], "999999 9999999") == 0, "mean / max capped");
+    CHECK(strcmp(lines[2], "idle          ") == 0, "name padded to 14");
+    CHECK(strcmp(lines[3], "     0       0") == 0, "zeros");
+    for(i = 0; i < 4; i++)
+        CHECK(strlen(lines[i]) == 14, "LCD row width");
+}
+
+//
+// clock_gettime backend - CYCCNT counts ns
+//
+static void test_host_clock(void){
+    struct timespec ts = {0, 2000000};  // 2ms
+    Prof_stats_t st;
+    int8_t a;
+    int i;
+
+    host_reset();
+    host_dwt_clock = host_dwt_ns;
+    Prof_Init();
+    a = Prof_section("sleep 2ms");
+    for(i = 0; i < 5; i++){
+        PROF_SCOPE(a){
+            nanosleep(&ts, 0);
+        }
+    }
+    Prof_get(a, &st);
+    CHECK(st.count == 5, "host sections counted");
+    CHECK(st.min >= 2000000 && st.max < 200000000, "host clock in ns");
+    printf("  host clock   sleep 2ms: min %u ns, max %u ns\n", (unsigned)st.min, (unsigned)st.max);
+}
+
+int main(void){
+    test_stats();
+    test_overhead();
+    test_pool();
+    test_dump();
+    test_host_clock();
+
+    return host_test_end("prof_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,260 @@
+/*
+ * pt_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     coroutine macros, clock bring-up and LCD start up interleaved
+ *      Rev:    0.2     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_pt and the coroutine bring-up routines
+ *  The test plays the hardware between calls - the PCM busy bit, the
+ *  VCORE1 transition, the HFXT fault flag and the clock ready bits change
+ *  after a number of checks, as they would while the CPU spun on them
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o pt_host_test host/pt_host_test.c msoe_lib_clk.c msoe_lib_lcd.c msoe_lib_fmt.c host/msp432_host.c
+ *      ./pt_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_pt.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_lcd.h"
+
+void EUSCIA3_IRQHandler(void);
+
+////////////////////////////////////////////
+//
+// Macro semantics
+//
+////////////////////////////////////////////
+static uint8_t flag;
+static uint8_t steps;
+static uint8_t limit;
+static Pt_t child_pt;
+
+static uint8_t child(Pt_t *pt){
+    PT_BEGIN(pt);
+    steps++;
+    PT_YIELD(pt);
+    steps++;
+    PT_END(pt);
+}
+
+static uint8_t parent(Pt_t *pt){
+    PT_BEGIN(pt);
+    steps = 1;
+    PT_WAIT_UNTIL(pt, flag);            // 2nd call on
+    steps = 10;
+    PT_YIELD(pt);
+    steps = 20;
+    PT_SPAWN(pt, &child_pt, child(&child_pt));
+    limit = 3;
+    PT_WAIT_LIMIT(pt, flag == 2, limit);
+    if(limit == 0)
+        PT_EXIT(pt);
+    steps = 30;
+    PT_END(pt);
+}
+
+static void test_macros(void){
+    Pt_t pt;
+    uint8_t r;
+
+    PT_INIT(&pt);
+    flag = 0;
+    CHECK(parent(&pt) == PT_WAITING && steps == 1, "waits on the condition");
+    CHECK(parent(&pt) == PT_WAITING && steps == 1, "still waiting, code before the wait not repeated");
+    flag = 1;
+    CHECK(parent(&pt) == PT_YIELDED && steps == 10, "condition true - runs to the yield");
+    CHECK(parent(&pt) == PT_WAITING && steps == 21, "yield continues, child runs to its yield");
+    CHECK(parent(&pt) == PT_WAITING && steps == 22, "child ends - parent waits on the limit");
+    CHECK(parent(&pt) == PT_WAITING, "limit 2 left");
+    r = parent(&pt);
+    CHECK(r == PT_EXITED && limit == 0 && steps == 22, "limit ran out - exit");
+    CHECK(!PT_SCHEDULE(r), "exited is not scheduled");
+
+    flag = 2;                           // restarted from the top by PT_EXIT
+    CHECK(parent(&pt) == PT_YIELDED && steps == 10, "restart");
+    parent(&pt);
+    r = parent(&pt);
+    CHECK(r == PT_ENDED && steps == 30 && limit == 3, "condition met before the limit - ends");
+
+    PT_INIT(&pt);
+    flag = 2;
+    steps = 0;
+    while(PT_SCHEDULE(parent(&pt)))
+        ;
+    CHECK(steps == 30, "run to the end");
+}
+
+////////////////////////////////////////////
+//
+// Clock bring-up
+//
+////////////////////////////////////////////
+//
+// Hardware state changes after a number of checks of each status register
+// (counted by how often the coroutine asks for another call)
+//
+typedef struct {
+    uint32_t pmr_busy;                  // calls with PCM busy (first wait)
+    uint32_t vcore;                     // calls before AM_LDO_VCORE1
+    uint32_t hfxt;                      // calls with the HFXT fault flag
+    uint32_t stat;                      // calls before the clocks are ready
+} hw_t;
+
+static uint32_t calls;
+
+static void hw_start(void){
+    host_reset();
+    calls = 0;
+    Clock_MCLK_freq = 3000000;
+    PCM->CTL1 = 0x00000100;
+    CS->IFG = 0x00000002;
+}
+
+//
+// One call of the coroutine, then the hardware moves on - each status
+// clears once its own wait has been checked enough times
+//
+static uint8_t clock_step(Pt_t *pt, int *result, const hw_t *hw){
+    static uint32_t n[4];
+    uint8_t r;
+
+    if(calls == 0)
+        n[0] = n[1] = n[2] = n[3] = 0;
+    r = Clock_Init_48MHz_pt(pt, result);
+    calls++;
+    if(PCM->CTL1 & 0x00000100){
+        if(++n[0] >= hw->pmr_busy)
+            PCM->CTL1 &= ~0x00000100;
+    }
+    else if((PCM->CTL0 & 0x00003F00) != 0x00000100 && (PCM->CTL0 & 0x0000000F) == 1){
+        if(++n[1] >= hw->vcore)
+            PCM->CTL0 = (PCM->CTL0 & ~0x00003F00) | 0x00000100;
+    }
+    else if(CS->KEY == 0x695A && (CS->IFG & 0x00000002)){
+        if(++n[2] >= hw->hfxt)
+            CS->IFG = 0;
+    }
+    else if(CS->CTL1 != 0){
+        if(++n[3] >= hw->stat)
+            CS->STAT = 0x0F020004;
+    }
+    return r;
+}
+
+static void test_clock(void){
+    static const hw_t hw = {5, 7, 40, 3};
+    static const hw_t stuck_pmr = {200000, 1, 1, 1};
+    static const hw_t stuck_hfxt = {1, 1, 200000, 1};
+    Pt_t pt;
+    int result = -1;
+    uint32_t waits = 0, yields = 0;
+    uint8_t r;
+
+    hw_start();
+    PT_INIT(&pt);
+    do{
+        r = clock_step(&pt, &result, &hw);
+        waits += r == PT_WAITING;
+        yields += r == PT_YIELDED;
+    } while(PT_SCHEDULE(r));
+    CHECK(r == PT_ENDED && result == 0, "bring-up completes");
+    CHECK(yields == 40 && waits == 5 + 7 + 3, "one return per status check not yet done");
+    CHECK(CS->CTL1 == 0x20101255 && CS->KEY == 0, "clocks selected, key cleared");
+    CHECK((FLCTL->BANK0_RDCTL & 0xF000) == 0x1000, "one flash wait state");
+    CHECK(Clock_MCLK_freq == 48000000 && Clock_SMCLK_freq == 12000000, "frequencies published");
+    printf("  clock        %u calls (%u waiting, %u yielded)\n", (unsigned)calls, (unsigned)waits, (unsigned)yields);
+
+    hw_start();
+    PT_INIT(&pt);
+    while(PT_SCHEDULE(r = clock_step(&pt, &result, &stuck_pmr)))
+        ;
+    CHECK(r == PT_EXITED && result == 1 && calls == 100000, "PCM busy timeout - 100000 checks");
+    CHECK((PCM->CTL0 & 0xFFFF) == 0 && CS->KEY == 0, "no changes made");
+
+    hw_start();
+    PT_INIT(&pt);
+    while(PT_SCHEDULE(r = clock_step(&pt, &result, &stuck_hfxt)))
+        ;
+    CHECK(r == PT_EXITED && result == 5, "HFXT timeout");
+    CHECK(calls == 1 + 1 + 100000, "100000 HFXT checks");
+
+    hw_start();
+    PCM->IFG = 0x00000004;              // invalid transition
+    PT_INIT(&pt);
+    while(PT_SCHEDULE(r = clock_step(&pt, &result, &hw)))
+        ;
+    CHECK(r == PT_EXITED && result == 2 && PCM->CLRIFG == 0x00000004, "invalid transition");
+
+    hw_start();
+    PCM->CTL1 = 0;
+    PCM->CTL0 = 0x00000100;
+    CS->IFG = 0;
+    CS->STAT = 0x0F020004;
+    CHECK(Clock_Init_48MHz() == 0, "blocking call - nothing to wait for");
+}
+
+////////////////////////////////////////////
+//
+// Clock and LCD interleaved at start up
+//
+////////////////////////////////////////////
+//
+// The LCD commands are queued while the crystal starts - one loop runs
+// both, the LCD is done before the clock
+//
+static void test_boot(void){
+    static const hw_t hw = {2, 2, 50, 2};
+    Pt_t clk, lcd;
+    int result = -1;
+    uint8_t clk_run = 1, lcd_run = 1;
+    uint32_t lcd_done = 0;
+    uint32_t held = 0;
+
+    hw_start();
+    host_dc_port = P9;
+    host_dc_mask = 0x04;
+    PT_INIT(&clk);
+    PT_INIT(&lcd);
+    while(clk_run | lcd_run){
+        if(clk_run)
+            clk_run = PT_SCHEDULE(clock_step(&clk, &result, &hw));
+        if(lcd_run){
+            lcd_run = PT_SCHEDULE(LCD_Config_pt(&lcd));
+            held += lcd_run && !(P9->OUT & 0x08);       // P9.3 reset
+            if(!lcd_run)
+                lcd_done = calls;
+        }
+    }
+    CHECK(result == 0, "clock up");
+    CHECK(held == 4, "reset held over 4 returns");
+    CHECK(lcd_done > 0 && lcd_done < calls / 2, "LCD configured while the clock waited");
+    CHECK((P9->OUT & 0x08) && LCD_flush_busy(), "reset released, clear started");
+    while(host_eusci_a3.IE & 0x0002)
+        EUSCIA3_IRQHandler();
+    CHECK(host_spi_count == 8 && host_spi_log[0].data == 0x21 && host_spi_log[5].data == 0x0C,
+          "configuration commands sent");
+
+    PT_INIT(&lcd);
+    CHECK(LCD_Config_pt(&lcd) == PT_WAITING && (P9->OUT & 0x08), "reconfigure waits for the clear to be sent");
+    host_dma_run(6);
+    CHECK(!LCD_flush_busy(), "clear sent");
+    CHECK(LCD_Config_pt(&lcd) == PT_YIELDED && !(P9->OUT & 0x08), "then resets the LCD");
+    printf("  boot         LCD done after %u of %u clock calls\n", (unsigned)lcd_done, (unsigned)calls);
+}
+
+int main(void){
+    test_macros();
+    test_clock();
+    test_boot();
+
+    return host_test_end("pt_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,226 @@
+/*
+ * sched_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     priority order, queue full and wrap, idle sleep
+ *      Rev:    0.2     time asleep
+ *      Rev:    0.3     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_sched - the test posts events as the
+ *  interrupts would (also from inside tasks and from the WFI hook, as an
+ *  interrupt waking the CPU) and checks the order the tasks see them in
+ *  Sched_run never returns - the WFI hook jumps out of it when done
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o sched_host_test host/sched_host_test.c msoe_lib_sched.c host/msp432_host.c
+ *      ./sched_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <setjmp.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_sched.h"
+
+//
+// Every task logs (task << 16 | event)
+//
+static uint32_t log_buf[256];
+static uint32_t log_n;
+static int8_t id_a, id_b, id_c;
+
+static void task_a(uint32_t ev){ log_buf[log_n++ & 0xFF] = 0xA0000 | ev; }
+static void task_b(uint32_t ev){ log_buf[log_n++ & 0xFF] = 0xB0000 | ev; }
+
+//
+// C posts to A while it runs (as an interrupt would) - A must run next
+//
+static void task_c(uint32_t ev){
+    log_buf[log_n++ & 0xFF] = 0xC0000 | ev;
+    if(ev == 1)
+        Sched_post(id_a, 99);
+}
+
+static void test_task(void){
+    static uint32_t q[8];
+    int ok = 1;
+    uint32_t i;
+
+    Sched_Init();
+    CHECK(Sched_task(task_a, 0, q, 6) == -1, "size not a power of 2");
+    CHECK(Sched_task(task_a, 0, q, 1) == -1, "size 1");
+    CHECK(Sched_task(task_a, 0, 0, 8) == -1, "no buffer");
+    CHECK(Sched_task(0, 0, q, 8) == -1, "no routine");
+    for(i = 0; i < SCHED_MAX; i++)
+        ok &= Sched_task(task_a, 0, q, 8) == (int8_t)i;
+    CHECK(ok, "ids in order");
+    CHECK(Sched_task(task_a, 0, q, 8) == -1, "no task free");
+    CHECK(Sched_post(SCHED_MAX, 1) == 0 && Sched_post(-1, 1) == 0, "bad id");
+    CHECK(Sched_run_once() == 0, "nothing to run");
+}
+
+static void test_order(void){
+    static uint32_t qa[4], qb[8], qc[4];
+    static const uint32_t want[] = {
+        0xA0001, 0xA0002,               // A first - priority 0
+        0xC0001, 0xA0063,               // C posts to A, A runs before C again
+        0xC0002,
+        0xB0001, 0xB0002, 0xB0003,      // B last - priority 3, FIFO
+    };
+    uint32_t i;
+    int ok = 1;
+
+    Sched_Init();
+    id_b = Sched_task(task_b, 3, qb, 8);
+    id_c = Sched_task(task_c, 1, qc, 4);
+    id_a = Sched_task(task_a, 0, qa, 4);
+    log_n = 0;
+
+    Sched_post(id_b, 1);
+    Sched_post(id_c, 1);
+    Sched_post(id_b, 2);
+    Sched_post(id_a, 1);
+    Sched_post(id_c, 2);
+    Sched_post(id_b, 3);
+    Sched_post(id_a, 2);
+    while(Sched_run_once())
+        ;
+    CHECK(log_n == sizeof(want) / sizeof(want[0]), "every event run once");
+    for(i = 0; i < log_n && i < sizeof(want) / sizeof(want[0]); i++)
+        ok &= log_buf[i] == want[i];
+    CHECK(ok, "priority order, FIFO within a task");
+}
+
+static void test_full(void){
+    static uint32_t qa[4], qb[4];
+    Sched_stats_t st;
+    uint32_t i, ev = 0, next = 0;
+    int ok = 1;
+
+    Sched_Init();
+    id_a = Sched_task(task_a, 5, qa, 4);
+    id_b = Sched_task(task_b, 5, qb, 4);         // same priority - added later, runs later
+
+    for(i = 0; i < 4; i++)
+        CHECK(Sched_post(id_a, i) == 1, "queued");
+    CHECK(Sched_post(id_a, 4) == 0 && Sched_post(id_a, 5) == 0, "full, dropped");
+    Sched_post(id_b, 7);
+    log_n = 0;
+    while(Sched_run_once())
+        ;
+    CHECK(log_n == 5 && log_buf[0] == 0xA0000 && log_buf[3] == 0xA0003
+          && log_buf[4] == 0xB0007, "dropped events never run, equal priority in order added");
+    Sched_stats(id_a, &st);
+    CHECK(st.runs == 4 && st.drops == 2 && st.high == 4, "runs, drops, high water");
+    Sched_stats(SCHED_MAX, &st);
+    CHECK(st.runs == 0 && st.drops == 0, "bad id stats");
+
+    //
+    // Indexes wrap past 256 many times - 3 in, 2 out
+    //
+    log_n = 0;
+    for(i = 0; i < 2000; i++){
+        Sched_post(id_a, ev++);
+        Sched_post(id_a, ev++);
+        Sched_post(id_a, ev++);         // lost when full
+        Sched_run_once();
+        Sched_run_once();
+    }
+    while(Sched_run_once())
+        ;
+    Sched_stats(id_a, &st);
+    CHECK(st.runs + st.drops == 6 + 6000 && st.drops > 2, "every event run or counted");
+    //
+    // The last 256 run are in increasing order with no repeats
+    //
+    for(i = log_n - 256; i < log_n; i++){
+        ok &= (log_buf[i & 0xFF] & 0xFFFF) >= next;
+        next = (log_buf[i & 0xFF] & 0xFFFF) + 1;
+    }
+    CHECK(ok, "FIFO across the wrap");
+    printf("  full         %u runs %u drops\n", (unsigned)st.runs, (unsigned)st.drops);
+}
+
+//
+// Sched_run - the WFI hook plays the interrupts, three wakes with an
+// event, then one with none (a spurious wake), then leaves
+//
+static jmp_buf run_done;
+static uint32_t wakes;
+
+static void wfi_post(void){
+    wakes++;
+    if(wakes <= 3)
+        Sched_post(id_a, wakes);
+    else if(wakes == 5)
+        longjmp(run_done, 1);
+}
+
+static void test_run(void){
+    static uint32_t qa[4];
+
+    Sched_Init();
+    id_a = Sched_task(task_a, 0, qa, 4);
+    Sched_post(id_a, 0);                // waiting before the loop starts
+    log_n = 0;
+    wakes = 0;
+    host_wfi_hook = wfi_post;
+    if(!setjmp(run_done))
+        Sched_run();
+    host_wfi_hook = 0;
+
+    CHECK(log_n == 4 && log_buf[0] == 0xA0000 && log_buf[3] == 0xA0003, "events run between sleeps");
+    CHECK(Sched_idle() == 5, "slept only with nothing to do");
+}
+
+//
+// Time asleep - each sleep lasts 100us on a test clock, a task 30us
+//
+static uint32_t now;
+
+static uint32_t clock_us(void){ return now; }
+static void task_busy(uint32_t ev){ now += 30; (void)ev; }
+
+static void wfi_sleep(void){
+    now += 100;
+    wfi_post();
+}
+
+static void test_sleep(void){
+    static uint32_t qa[4];
+
+    Sched_Init();
+    id_a = Sched_task(task_busy, 0, qa, 4);
+    now = 0;
+    wakes = 0;
+    host_wfi_hook = wfi_sleep;
+    if(!setjmp(run_done))
+        Sched_run();
+    CHECK(Sched_sleep_us() == 0, "no clock - not measured");
+
+    Sched_Init();
+    id_a = Sched_task(task_busy, 0, qa, 4);
+    Sched_clock(clock_us);
+    now = 0;
+    wakes = 0;
+    if(!setjmp(run_done))
+        Sched_run();
+    host_wfi_hook = 0;
+    Sched_clock(0);
+    // 4 full sleeps (the 5th jumps out before the clock is read), 3 events
+    CHECK(Sched_sleep_us() == 4 * 100 && now == 5 * 100 + 3 * 30, "only sleep counted");
+}
+
+int main(void){
+    test_task();
+    test_order();
+    test_full();
+    test_run();
+    test_sleep();
+
+    return host_test_end("sched_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
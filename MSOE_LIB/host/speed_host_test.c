@@ -0,0 +1,111 @@
+/*
+ * speed_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     period to speed against the IR app's formula
+ *      Rev:    0.2     integer tenths of mph against the float formulas
+ *      Rev:    0.3     CHECK and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_speed - the speed in tenths of mph from
+ *  a capture period must be the float formula rounded, for every period
+ *  the display shows (0.1 to 99.9mph) and across the whole 32 bit range,
+ *  and must match the IR app's original formula, which took the period
+ *  in 0.5ms timer ticks (Speed = (1/(ticks*0.0014008))*2)
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -O2 -I host -I . -o speed_host_test host/speed_host_test.c msoe_lib_speed.c -lm
+ *      ./speed_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <math.h>
+#include "host_test.h"
+#include "msoe_lib_speed.h"
+
+//
+// Float formula in tenths
+//
+static double tenths(uint32_t period){
+    return 36000.0 * SPEED_TICK_HZ / (SPEED_REV_PER_MI * period);
+}
+
+//
+// More than half a tenth out - allowing for the constant rounded to an
+// integer (half a count over the period)
+//
+static int off(uint32_t period){
+    return fabs(Speed_tenths(period) - tenths(period)) > 0.5 + 0.5 / period + 1e-9;
+}
+
+//
+// Every period from 99.95mph to 0.05mph - the display range
+//
+static void test_display(void){
+    uint32_t lo = (uint32_t)(tenths(1) / 999.5);
+    uint32_t hi = (uint32_t)(tenths(1) / 0.5);
+    uint32_t p, bad = 0;
+    double err, worst = 0;
+
+    for(p = lo; p <= hi; p++){
+        err = fabs(Speed_tenths(p) - tenths(p));
+        if(err > worst)
+            worst = err;
+        bad += off(p);
+    }
+    CHECK(bad == 0, "rounded to the nearest tenth");
+    CHECK(Speed_tenths(lo) <= 1000 && Speed_tenths(lo + 1) == 999 && Speed_tenths(hi) <= 1, "range ends");
+    printf("  display      periods %u to %u, worst %.3f tenths\n", (unsigned)lo, (unsigned)hi, worst);
+}
+
+//
+// 1 tick to 2^32 - 1 in steps of ~0.1%
+//
+static void test_range(void){
+    uint64_t p;
+    uint32_t bad = 0, n = 0;
+
+    for(p = 1; p < 0x100000000ULL; p += p / 1024 + 1){
+        bad += off((uint32_t)p);
+        n++;
+    }
+    bad += Speed_tenths(0xFFFFFFFF) != 0;
+    CHECK(bad == 0, "whole 32 bit range");
+    CHECK(Speed_tenths(0) == 0, "period 0");
+    printf("  range        %u periods\n", (unsigned)n);
+}
+
+//
+// The app's formula on 0.5ms ticks - 6000 periods of 12MHz
+//
+static void test_formula(void){
+    uint32_t ticks, bad = 0;
+    double old;
+
+    for(ticks = 1; ticks <= 20000; ticks++){
+        old = (1 / (ticks * 0.0014008)) * 2 * 10;
+        bad += fabs(Speed_tenths(ticks * 6000) - old) > 0.5 + old * 0.0005;
+    }
+    CHECK(bad == 0, "matches the 0.5ms tick formula (its constant is 0.02% off)");
+}
+
+static void test_points(void){
+    // 1.047ft in 0.1s - 10.47ft/s, 7.14mph
+    CHECK(Speed_tenths(1200000) == 71, "10 revolutions a second");
+    // 60mph - 5042 revolutions a mile, 84 a second
+    CHECK(Speed_tenths(142800) == 600, "60mph");
+    CHECK(Speed_tenths(1) == SPEED_TENTHS_TICKS, "one tick");
+    CHECK(SPEED_TENTHS_TICKS < 0x80000000UL, "constant under 2^31");
+}
+
+int main(void){
+    test_display();
+    test_range();
+    test_formula();
+    test_points();
+
+    return host_test_end("speed_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,275 @@
+/*
+ * tach_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     interleaved channels, lockouts, timeouts
+ *      Rev:    0.2     CHECK, rnd and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_tach - edge streams for several channels
+ *  at different speeds, with noise edges in the lockouts, are merged in
+ *  time order (across the 2^32 us wrap) and fed to the channels. Each
+ *  channel must give its own stream's periods, filter output and counts,
+ *  untouched by the others. Channels stopping and starting again are
+ *  checked against their timeouts
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o tach_host_test host/tach_host_test.c msoe_lib_tach.c msoe_lib_filt.c msoe_lib_time.c msoe_lib_clk.c host/msp432_host.c
+ *      ./tach_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_time.h"
+#include "msoe_lib_filt.h"
+#include "msoe_lib_tach.h"
+
+static const Filt_cfg_t cfg = {FILT_MEDIAN | FILT_AVG, 4, 0};
+
+static void test_config(void){
+    static const Filt_cfg_t bad = {FILT_AVG | FILT_EMA, 4, 2};
+
+    CHECK(Tach_Init(&bad) == 1, "bad filter settings");
+    CHECK(Tach_Init(&cfg) == 0, "filter settings");
+    CHECK(Tach_channel(TACH_MAX, 0, 1000) == 1, "no such channel");
+    CHECK(Tach_channel(0, 0, 0) == 1, "timeout 0");
+    CHECK(Tach_channel(0, 1000, 1000) == 1, "timeout not past the lockout");
+    CHECK(Tach_channel(0, 0, 0x80000000UL) == 1, "timeout over 2^31");
+    CHECK(Tach_channel(0, 0, 0x7FFFFFFFUL) == 0 && Tach_state[0] == TACH_STOPPED, "longest timeout");
+
+    Tach_edge_at(1, 100);
+    Tach_edge_at(1, 200);
+    CHECK(Tach_state[1] == TACH_OFF && Tach_count[1] == 0 && Tach_period(1) == 0, "channel off - edges ignored");
+    Tach_edge_at(TACH_MAX, 100);
+    CHECK(Tach_period(TACH_MAX) == 0 && Tach_rpm(TACH_MAX) == 0, "no such channel - 0");
+
+    Tach_edge_at(0, 1000);
+    CHECK(Tach_state[0] == TACH_STARTED && Tach_period(0) == 0, "first edge - started");
+    Tach_edge_at(0, 8000);
+    CHECK(Tach_state[0] == TACH_RUNNING && Tach_last(0) == 7000 && Tach_period(0) == 7000, "period");
+    CHECK(Tach_rpm(0) == 8571, "7ms - 8571 RPM");
+}
+
+//
+// Channel streams - period (us) with 1% jitter, and now and then a burst
+// of noise edges inside the lockout
+//
+typedef struct {
+    uint32_t period;
+    uint32_t lockout;
+    uint32_t timeout;
+    uint32_t next;                  // next edge
+    uint32_t last;                  // last real edge
+    uint32_t stop_at;               // no edges after this many (0 never)
+    uint32_t edges;                 // real edges so far
+    uint32_t noise;                 // noise edges so far
+    uint32_t noise_left;            // noise edges still to come this period
+    Filt_t ref;                     // the same filter fed this stream
+} Stream_t;
+
+static Stream_t st[TACH_MAX];
+
+static void stream(uint8_t ch, uint32_t period, uint32_t stop_at, uint32_t start){
+    Stream_t *s = &st[ch];
+
+    s->period = period;
+    s->lockout = period / 2;
+    s->timeout = period * 4;
+    s->next = start + rnd() % period;
+    s->stop_at = stop_at;
+    s->edges = 0;
+    s->noise = 0;
+    s->noise_left = 0;
+    Filt_Init(&s->ref, &cfg);
+    Tach_channel(ch, s->lockout, s->timeout);
+}
+
+//
+// The stream's next edge - noise goes between the last real edge and its
+// lockout end
+//
+static uint8_t next_is_real(Stream_t *s){
+    return s->noise_left == 0;
+}
+
+static void advance(Stream_t *s){
+    uint32_t p;
+
+    if(s->noise_left){
+        s->noise_left--;
+        s->noise++;
+        if(s->noise_left)
+            s->next += 1 + rnd() % (s->lockout / 8);
+        else
+            s->next = s->last + s->period + s->period / 100 * ((int32_t)(rnd() % 3) - 1);
+        return;
+    }
+    s->edges++;
+    s->last = s->next;
+    p = s->period + (int32_t)(rnd() % (s->period / 50 + 1)) - (int32_t)(s->period / 100);
+    if(rnd() % 4 == 0){                         // noise burst after this edge
+        s->noise_left = 1 + rnd() % 6;
+        s->next = s->last + 1 + rnd() % (s->lockout / 8);
+    }
+    else
+        s->next = s->last + p;
+}
+
+static uint8_t live(Stream_t *s){
+    return s->period && (s->stop_at == 0 || s->edges < s->stop_at || !next_is_real(s));
+}
+
+//
+// Runs the streams from start for span us, polling every poll us
+// Returns the number of edges fed
+//
+static uint32_t run(uint32_t start, uint32_t span, uint32_t poll, int *ok){
+    uint32_t next_poll = start + poll, n = 0;
+    uint8_t ch, best;
+    uint32_t t, period;
+    int32_t d, dbest;
+    Stream_t *s;
+
+    for(;;){
+        best = TACH_MAX;
+        dbest = 0;
+        for(ch = 0; ch < TACH_MAX; ch++){
+            if(!live(&st[ch]))
+                continue;
+            d = (int32_t)(st[ch].next - start);
+            if(best == TACH_MAX || d < dbest){
+                best = ch;
+                dbest = d;
+            }
+        }
+        if(best == TACH_MAX || (uint32_t)dbest > span)
+            break;
+        s = &st[best];
+        t = s->next;
+        while((int32_t)(t - next_poll) >= 0){
+            Tach_poll(next_poll);
+            next_poll += poll;
+        }
+
+        if(next_is_real(s) && s->edges){
+            period = t - s->last;
+            Filt_add(&s->ref, period);
+        }
+        else
+            period = 0;
+        Tach_edge_at(best, t);
+        n++;
+
+        if(period){
+            if(Tach_last(best) != period || Tach_period(best) != s->ref.out){
+                if(*ok)
+                    printf("  channel %u edge %u: period %u/%u, want %u/%u\n", (unsigned)best, (unsigned)s->edges,
+                           (unsigned)Tach_last(best), (unsigned)Tach_period(best), (unsigned)period, (unsigned)s->ref.out);
+                *ok = 0;
+            }
+        }
+        advance(s);
+    }
+    return n;
+}
+
+static void test_interleaved(void){
+    static const uint32_t periods[4] = {7000, 20011, 61003, 1513};
+    uint32_t start = 0xFFFFFFFFUL - 3000000, ch, n;
+    int ok = 1, counts = 1;
+
+    Tach_Init(&cfg);
+    for(ch = 0; ch < TACH_MAX; ch++)
+        stream(ch, periods[ch & 3] + ch / 4 * 101, 0, start);
+    n = run(start, 20000000, 10000, &ok);
+    printf("  interleaved  %u edges on %u channels\n", (unsigned)n, (unsigned)TACH_MAX);
+    CHECK(ok, "each channel - its own periods and filter");
+    for(ch = 0; ch < TACH_MAX; ch++){
+        counts &= Tach_count[ch] == st[ch].edges - 1;          // the first edge only starts
+        counts &= Tach_spurious[ch] == st[ch].noise;
+        counts &= Tach_stops[ch] == 0 && Tach_state[ch] == TACH_RUNNING;
+    }
+    CHECK(counts, "periods, noise and stops counted per channel");
+    CHECK(Tach_rpm(3) > 39000 && Tach_rpm(3) < 40300, "1513us - ~39656 RPM");
+}
+
+//
+// One channel stops half way, the others run on - Tach_poll stops it
+// within its timeout and a poll. Then the timeout edges on one channel
+//
+static void test_timeout(void){
+    uint32_t start = 1000, ch, stops;
+    uint32_t t;
+    int ok = 1;
+
+    Tach_Init(&cfg);
+    for(ch = 0; ch < TACH_MAX; ch++)
+        stream(ch, 5000 + ch * 3000, ch == 1 ? 200 : 0, start);
+    run(start, 3000000, 1000, &ok);
+    CHECK(ok, "periods with a channel stopping");
+    CHECK(Tach_state[1] == TACH_STOPPED && Tach_stops[1] == 1 && Tach_period(1) == 0 && Tach_rpm(1) == 0, "stopped channel - 0");
+    stops = 0;
+    for(ch = 0; ch < TACH_MAX; ch++)
+        if(ch != 1)
+            stops += Tach_stops[ch] + (Tach_state[ch] != TACH_RUNNING);
+    CHECK(stops == 0, "the others still running");
+
+    //
+    // Poll just before and just after the timeout
+    //
+    t = st[0].last + 100000;
+    Tach_channel(0, 100, 20000);
+    Tach_edge_at(0, t);
+    Tach_edge_at(0, t + 5000);
+    Tach_poll(t + 5000 + 20000);
+    CHECK(Tach_state[0] == TACH_RUNNING, "at the timeout - running");
+    Tach_poll(t + 5000 + 20001);
+    CHECK(Tach_state[0] == TACH_STOPPED && Tach_stops[0] == 1 && Tach_last(0) == 0, "past the timeout - stopped");
+    Tach_edge_at(0, t + 60000);
+    Tach_edge_at(0, t + 64000);
+    CHECK(Tach_state[0] == TACH_RUNNING && Tach_period(0) == 4000, "restarted - filter starts again");
+
+    //
+    // Edge after the timeout with no poll in between - a stop, a new start
+    //
+    Tach_edge_at(0, t + 64000 + 20001);
+    CHECK(Tach_state[0] == TACH_STARTED && Tach_stops[0] == 2 && Tach_period(0) == 0, "late edge - started again");
+
+    //
+    // Poll with a time read before the last edge - not a timeout
+    //
+    Tach_edge_at(0, t + 100000);
+    Tach_poll(t + 99990);
+    CHECK(Tach_state[0] == TACH_RUNNING, "edge after the poll read the time");
+}
+
+//
+// Tach_edge reads the timebase - TIMER_A2 at 1MHz
+//
+static void test_timebase(void){
+    host_reset();
+    Clock_SMCLK_freq = 12000000;
+    Time_Init();
+    Tach_Init(&cfg);
+    Tach_channel(2, 0, 1000000);
+    TIMER_A2->R = 1000;
+    Tach_edge(2);
+    TIMER_A2->R = 11000;
+    Tach_edge(2);
+    CHECK(Tach_last(2) == 10000 && Tach_rpm(2) == 6000, "edges stamped with Time_now_us");
+}
+
+int main(void){
+    rnd_seed(5);
+    test_config();
+    test_interleaved();
+    test_timeout();
+    test_timebase();
+
+    return host_test_end("tach_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,163 @@
+/*
+ * time_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     timebase setup, overflow extension and wraparound
+ *      Rev:    0.2     64 bit time across the 2^48 us carry
+ *      Rev:    0.3     CHECK, rnd and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_time - the test plays TIMER_A2 counting
+ *  1us steps, sets the overflow flag and runs the overflow interrupt now
+ *  or some time later (as when it is held off by other interrupts) and
+ *  checks every reading against the true time
+ *
+ *  msoe_lib_time.c is included (not linked) so the overflow count can be
+ *  started near its wrap - 2^32 overflow interrupts would take minutes
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -I host -I . -o time_host_test host/time_host_test.c msoe_lib_clk.c host/msp432_host.c
+ *      ./time_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_time.c"
+
+void TA2_N_IRQHandler(void);
+
+static void test_init(void){
+    static const struct {
+        uint32_t smclk;
+        int ret;
+        uint16_t id;                    // ID bits 7:6
+        uint16_t ex;                    // TAIDEX
+    } cfg[] = {
+        {12000000, 0, 1, 5},            // /2 /6
+        {48000000, 0, 3, 5},            // /8 /6
+        {24000000, 0, 2, 5},            // /4 /6
+        {3000000, 0, 0, 2},
+        {1000000, 0, 0, 0},
+        {64000000, 0, 3, 7},
+        {7000000, 0, 0, 6},
+        {1500000, 1, 0, 0},             // not whole MHz
+        {13000000, 1, 0, 0},            // 13 is not ID x TAIDEX
+        {72000000, 1, 0, 0},            // more than 64
+        {375000, 1, 0, 0},
+    };
+    uint32_t i;
+    int ok = 1;
+
+    for(i = 0; i < sizeof(cfg) / sizeof(cfg[0]); i++){
+        host_reset();
+        Clock_SMCLK_freq = cfg[i].smclk;
+        if(Time_Init() != cfg[i].ret){
+            printf("  SMCLK %u\n", (unsigned)cfg[i].smclk);
+            ok = 0;
+            continue;
+        }
+        if(cfg[i].ret)
+            ok &= TIMER_A2->CTL == 0;
+        else
+            ok &= TIMER_A2->CTL == (0x0200 | (cfg[i].id << 6) | 0x0020 | 0x0002)
+                  && TIMER_A2->EX0 == cfg[i].ex
+                  && (NVIC->ISER[0] & (1UL << 13)) != 0;
+    }
+    CHECK(ok, "SMCLK divided to 1MHz - SMCLK, continuous, overflow interrupt");
+    Clock_SMCLK_freq = 12000000;
+}
+
+//
+// Random walk of the true time past 2^32 us - the overflow interrupt runs
+// at once or is held off (never past half a timer period)
+//
+static void test_wrap(void){
+    uint64_t t = 0;                     // true time in us
+    uint64_t prev = 0;
+    uint64_t t64;
+    uint32_t t32;
+    uint32_t steps = 0;
+    uint32_t late = 0;
+    int ok = 1;
+
+    host_reset();
+    Time_Init();
+    CHECK(Time_now_us64() == 0 && now_us() == 0, "starts at 0");
+
+    while(t < 0x100000000ULL + 5000000 && ok){
+        t += 1 + rnd() % 20000;
+        if((t >> 16) != (prev >> 16))
+            TIMER_A2->CTL |= 0x0001;    // overflow flag
+        TIMER_A2->R = (uint16_t)t;
+        if((TIMER_A2->CTL & 0x0001) && ((t & 0xFFFF) >= 0x6000 || rnd() % 2))
+            TA2_N_IRQHandler();
+        late += (TIMER_A2->CTL & 0x0001) != 0;
+
+        t64 = Time_now_us64();
+        t32 = now_us();
+        if(t64 != t || t32 != (uint32_t)t){
+            printf("  t %llu: us64 %llu, us %u\n", (unsigned long long)t,
+                   (unsigned long long)t64, (unsigned)t32);
+            ok = 0;
+        }
+        prev = t;
+        steps++;
+    }
+    CHECK(ok, "time read with the overflow counted and pending");
+    CHECK(late > 1000, "overflow interrupt held off");
+    CHECK(now_us() < 6000000 && Time_now_us64() > 0xFFFFFFFFULL, "32 bits wrapped, 64 bits did not");
+    printf("  wrap         %u reads to %llu us, %u with the overflow pending\n",
+           (unsigned)steps, (unsigned long long)t, (unsigned)late);
+
+    TIMER_A2->CTL &= ~0x0001;
+    TA2_N_IRQHandler();                 // another TIMER_A2 source - not an overflow
+    CHECK(Time_now_us64() == t, "interrupt without the flag not counted");
+}
+
+//
+// Overflow count started just below its wrap - the 64 bit time must carry
+// into Time_top at 2^48 us, the interrupt run at once or held off
+//
+static void test_carry(void){
+    uint64_t t = 0xFFFFFFFEULL << 16;
+    uint64_t end = (0x100000001ULL << 16) + 12345;
+    uint64_t prev = t;
+    uint64_t t64;
+    int ok = 1;
+
+    host_reset();
+    Time_Init();
+    Time_hi = 0xFFFFFFFE;
+
+    while(t < end && ok){
+        t += 1 + rnd() % 20000;
+        if((t >> 16) != (prev >> 16))
+            TIMER_A2->CTL |= 0x0001;
+        TIMER_A2->R = (uint16_t)t;
+        if((TIMER_A2->CTL & 0x0001) && ((t & 0xFFFF) >= 0x6000 || rnd() % 2))
+            TA2_N_IRQHandler();
+
+        t64 = Time_now_us64();
+        if(t64 != t || now_us() != (uint32_t)t){
+            printf("  t %llu: us64 %llu\n", (unsigned long long)t, (unsigned long long)t64);
+            ok = 0;
+        }
+        prev = t;
+    }
+    CHECK(ok, "64 bit time across 2^48 us");
+    CHECK(Time_top == 1 && Time_now_us64() > (1ULL << 48), "overflow count carried");
+}
+
+int main(void){
+    rnd_seed(99);
+    test_init();
+    test_wrap();
+    test_carry();
+
+    return host_test_end("time_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
@@ -0,0 +1,246 @@
+/*
+ * timer_host_test.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     timer wheel against a reference model
+ *      Rev:    0.2     CHECK, rnd and the result line from host_test.h
+ *
+ *  Host (Linux) test of msoe_lib_timer - SysTick_Handler is called directly
+ *  as the tick source
+ *
+ *  Build and run from MSOE_LIB:
+ *      gcc -std=c99 -O2 -I host -I . -o timer_host_test host/timer_host_test.c msoe_lib_timer.c msoe_lib_clk.c host/msp432_host.c
+ *      ./timer_host_test
+ */
+
+#if !defined(__TI_COMPILER_VERSION__)
+#include <stdio.h>
+#include <string.h>
+#include "msp432.h"
+#include "host_test.h"
+#include "msoe_lib_timer.h"
+
+void SysTick_Handler(void);
+
+//
+// One callback per job so the test can tell them apart
+//
+#define JOBS    TIMER_MAX
+
+static uint32_t fired[JOBS];            // callback count
+static uint32_t fired_at[JOBS];         // Timer_now() at the last callback
+
+#define JOB_CB(n)   static void job##n(void){ fired[n]++; fired_at[n] = Timer_now(); }
+JOB_CB(0)  JOB_CB(1)  JOB_CB(2)  JOB_CB(3)  JOB_CB(4)  JOB_CB(5)  JOB_CB(6)  JOB_CB(7)
+JOB_CB(8)  JOB_CB(9)  JOB_CB(10) JOB_CB(11) JOB_CB(12) JOB_CB(13) JOB_CB(14) JOB_CB(15)
+
+static void (*const job[JOBS])(void) = {
+    job0, job1, job2, job3, job4, job5, job6, job7,
+    job8, job9, job10, job11, job12, job13, job14, job15
+};
+
+static void ticks(uint32_t n){
+    while(n--)
+        SysTick_Handler();
+}
+
+static void clear_jobs(void){
+    memset(fired, 0, sizeof(fired));
+    memset(fired_at, 0, sizeof(fired_at));
+}
+
+//
+// SysTick setup, periodic and one shot basics
+//
+static void test_basic(void){
+    int8_t a;
+    int8_t b;
+
+    host_reset();
+    Timer_Init(48000000, 1000);
+    CHECK(SysTick->LOAD == 47999, "1ms reload at 48MHz");
+    CHECK(SysTick->CTRL == 0x0007, "SysTick enabled with interrupt");
+    CHECK(Timer_now() == 0, "tick count cleared");
+
+    clear_jobs();
+    a = Timer_start(job[0], 10, 0);
+    b = Timer_start(job[1], 5, 1);
+    CHECK(a >= 0 && b >= 0 && a != b, "two timers started");
+    ticks(4);
+    CHECK(fired[1] == 0, "one shot not early");
+    ticks(1);
+    CHECK(fired[1] == 1 && fired_at[1] == 5, "one shot after 5 ticks");
+    ticks(5);
+    CHECK(fired[0] == 1 && fired_at[0] == 10, "periodic after 10 ticks");
+    ticks(90);
+    CHECK(fired[0] == 10 && fired_at[0] == 100, "periodic every 10 ticks");
+    CHECK(fired[1] == 1, "one shot runs once");
+    Timer_stop(a);
+    ticks(100);
+    CHECK(fired[0] == 10, "stopped timer does not run");
+
+    CHECK(Timer_start(0, 10, 0) == -1, "no callback");
+    CHECK(Timer_start(job[0], 0, 0) == -1, "period 0");
+    CHECK(Timer_start(job[0], TIMER_PERIOD_MAX + 1, 0) == -1, "period too long");
+}
+
+//
+// Pool exhaustion and reuse
+//
+static void test_pool(void){
+    int8_t id[TIMER_MAX];
+    int i;
+    int ok = 1;
+
+    Timer_Init(48000000, 1000);
+    for(i = 0; i < TIMER_MAX; i++){
+        id[i] = Timer_start(job[i], 1000, 0);
+        ok &= id[i] >= 0;
+    }
+    CHECK(ok, "TIMER_MAX timers start");
+    CHECK(Timer_start(job[0], 1000, 0) == -1, "no free timer");
+    Timer_stop(id[3]);
+    Timer_stop(id[3]);                  // second stop is ignored
+    CHECK(Timer_start(job[3], 1000, 0) >= 0, "stopped timer reused");
+    CHECK(Timer_start(job[3], 1000, 0) == -1, "double stop freed it once");
+    for(i = 0; i < TIMER_MAX; i++)
+        Timer_stop((int8_t)i);
+}
+
+//
+// Callbacks that stop themselves, restart and start other timers
+//
+static int8_t self_id;
+static uint32_t self_runs;
+static uint32_t chain_runs;
+
+static void self_stop(void){
+    if(++self_runs == 3)
+        Timer_stop(self_id);
+}
+static void chain(void){
+    chain_runs++;
+    if(chain_runs < 5)
+        Timer_start(chain, 64, 1);      // lands in the slot being run
+}
+
+static void test_callbacks(void){
+    uint32_t start;
+
+    Timer_Init(48000000, 1000);
+    self_runs = 0;
+    self_id = Timer_start(self_stop, 7, 0);
+    ticks(100);
+    CHECK(self_runs == 3, "periodic timer stops itself");
+
+    chain_runs = 0;
+    Timer_start(chain, 64, 1);
+    ticks(64);
+    CHECK(chain_runs == 1, "restart in the same slot waits a full turn");
+    ticks(64 * 4);
+    CHECK(chain_runs == 5, "one shot restarted from its callback");
+
+    clear_jobs();
+    start = Timer_now();
+    Timer_start(job[0], 64, 0);         // period of one level 0 turn
+    ticks(640);
+    CHECK(fired[0] == 10 && fired_at[0] == start + 640, "period 64");
+}
+
+//
+// Random starts and stops against a model of when each job is due
+// Jobs 0-7 churn with short periods, jobs 8-15 keep long periods running
+// (rarely stopped) - periods cluster around the level boundaries (64^n) so
+// every cascade is hit
+//
+static uint32_t random_period(int k){
+    static const uint32_t edge[] = {64, 4096, 262144, TIMER_PERIOD_MAX};
+    uint32_t p;
+    switch(rnd() % 3 + (k >= JOBS / 2)){
+    case 0:  p = 1 + rnd() % 200; break;
+    case 1:  p = 1 + rnd() % 20000; break;
+    case 2:  p = 1 + rnd() % 2000000; break;
+    default:
+        p = edge[rnd() % 4] - 3 + rnd() % 6;
+        if(p > TIMER_PERIOD_MAX)
+            p = TIMER_PERIOD_MAX;
+        break;
+    }
+    return p;
+}
+
+static void test_random(void){
+    int8_t id[JOBS];
+    uint32_t period[JOBS];
+    uint32_t due[JOBS];
+    uint8_t active[JOBS];
+    uint8_t oneshot[JOBS];
+    uint32_t count[JOBS];
+    uint32_t step;
+    uint32_t now;
+    uint32_t runs = 0;
+    uint32_t long_runs = 0;
+    int k;
+    int ok = 1;
+
+    Timer_Init(48000000, 1000);
+    clear_jobs();
+    memset(active, 0, sizeof(active));
+    memset(count, 0, sizeof(count));
+
+    for(step = 0; step < 40000000 && ok; step++){
+        if(rnd() % 2048 == 0){
+            k = rnd() % JOBS;
+            if(active[k]){
+                if(k < JOBS / 2 || rnd() % 256 == 0){
+                    Timer_stop(id[k]);
+                    active[k] = 0;
+                }
+            }
+            else{
+                period[k] = random_period(k);
+                oneshot[k] = rnd() % 3 == 0;
+                id[k] = Timer_start(job[k], period[k], oneshot[k]);
+                ok &= id[k] >= 0;
+                due[k] = Timer_now() + period[k];
+                active[k] = 1;
+            }
+        }
+        SysTick_Handler();
+        now = Timer_now();
+        for(k = 0; k < JOBS; k++){
+            if(active[k] && due[k] == now){
+                count[k]++;
+                runs++;
+                long_runs += period[k] >= 262144;
+                if(oneshot[k])
+                    active[k] = 0;
+                else
+                    due[k] += period[k];
+            }
+            if(fired[k] != count[k]){
+                printf("  job %d at tick %u: %u runs, expected %u\n",
+                       k, (unsigned)now, (unsigned)fired[k], (unsigned)count[k]);
+                ok = 0;
+                break;
+            }
+        }
+    }
+    CHECK(ok, "random timers run on the ticks the model expects");
+    CHECK(long_runs > 50, "level 3 timers ran");
+    printf("  random       %u ticks, %u callbacks (%u from level 3)\n",
+           (unsigned)step, (unsigned)runs, (unsigned)long_runs);
+}
+
+int main(void){
+    rnd_seed(2024);
+    test_basic();
+    test_pool();
+    test_callbacks();
+    test_random();
+
+    return host_test_end("timer_host_test");
+}
+
+#endif // !__TI_COMPILER_VERSION__
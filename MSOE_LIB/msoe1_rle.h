@@ -0,0 +1,33 @@
+/*
+ * msoe1_rle.h
+ *
+ *  Generated by host/bmp_rle_gen.c from msoe1.h - 504 bytes run length encoded to 212
+ *  - do not edit, rerun the generator instead
+ *
+ */
+#ifndef __MSOE_LIB_MSOE1_RLE_H__
+#define __MSOE_LIB_MSOE1_RLE_H__
+////////////////////////////////////
+//
+// msoe1.h for LCD_print_bmpRLE
+//
+////////////////////////////////////
+#include <stdint.h>
+
+static const uint8_t msoe1_rle [] = {
+  0x90,0x00,0x84,0xFF,0x01,0xDF,0x9F,0x81,0x1F,0x00,0x3F,0x87,0xFF,0x00,0x7F,0x82,
+  0x1F,0x07,0xDF,0xFF,0xFF,0x7F,0x3F,0xBF,0xDF,0xDF,0x83,0xFF,0x03,0xDF,0xFF,0xBF,
+  0x3F,0x83,0xFF,0xA2,0x00,0x87,0xFF,0x05,0xFE,0xF8,0xC0,0x01,0x0F,0x3F,0x85,0xFF,
+  0x81,0x00,0x82,0xFF,0x03,0xC0,0x80,0x87,0x07,0x81,0x0F,0x80,0x1F,0x81,0x3F,0x01,
+  0x7F,0x7E,0x83,0xFF,0xA2,0x00,0x84,0xFF,0x03,0x7F,0x3F,0x3F,0x7F,0x81,0xFF,0x04,
+  0xF0,0xC0,0x01,0xC7,0xFB,0x81,0xFF,0x00,0x7F,0x81,0x00,0x00,0x03,0x81,0xFF,0x01,
+  0x9F,0xBF,0x83,0xFF,0x81,0xFE,0x04,0x7C,0x3C,0x80,0xC0,0xE0,0x82,0xFF,0xA2,0x00,
+  0x84,0xFF,0x07,0x1F,0x0F,0x07,0xE3,0xF9,0xFC,0xFE,0xFE,0x82,0xFF,0x80,0xFE,0x0B,
+  0xFD,0xF3,0xC3,0x07,0x0F,0x3F,0xFF,0xFE,0xFE,0x01,0x00,0x00,0x88,0xFE,0x01,0xFC,
+  0xF0,0x82,0xFF,0xA2,0x00,0x83,0xFF,0x04,0xE0,0x80,0x00,0x07,0x7F,0x8A,0xFF,0x03,
+  0x3F,0x00,0x00,0xC0,0x81,0xFF,0x81,0x00,0x86,0xFD,0x00,0xF8,0x85,0xFF,0xA2,0x00,
+  0x86,0xFF,0x05,0xFE,0xFC,0xFD,0xFB,0xFF,0xF7,0x82,0xFF,0x06,0xF7,0xFF,0xFB,0xFC,
+  0xFC,0xFE,0xFF,0x81,0xF7,0x00,0xF3,0x81,0xF0,0x00,0xF3,0x87,0xF7,0x01,0xF3,0xF0,
+  0x82,0xFF,0x90,0x00 };
+
+#endif // __MSOE_LIB_MSOE1_RLE_H__
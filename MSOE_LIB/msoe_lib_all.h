@@ -14,3 +14,15 @@
 #include "msoe_lib_lcd.h"
 #include "msoe_lib_delay.h"
 #include "msoe_lib_misc.h"
+#include "msoe_lib_fmt.h"
+#include "msoe_lib_timer.h"
+#include "msoe_lib_prof.h"
+#include "msoe_lib_err.h"
+#include "msoe_lib_time.h"
+#include "msoe_lib_sched.h"
+#include "msoe_lib_pt.h"
+#include "msoe_lib_gov.h"
+#include "msoe_lib_cap.h"
+#include "msoe_lib_speed.h"
+#include "msoe_lib_filt.h"
+#include "msoe_lib_tach.h"
@@ -0,0 +1,237 @@
+/*
+ * msoe_lib_cap.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     period measurement by TIMER_A input capture
+ *      Rev:    0.2     lockout after each edge - glitch rejection
+ *
+ */
+#ifndef __MSOE_LIB_CAP_C__
+#define __MSOE_LIB_CAP_C__
+////////////////////////////////////////////
+//
+// Input Capture Routines - see msoe_lib_cap.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msp432.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_cap.h"
+
+#define CAP_TIMER               TIMER_A1
+#define CAP_TIMER_IRQn          TA1_N_IRQn
+#define CAP_TIMER_IRQHandler    TA1_N_IRQHandler
+#define CAP_CCR_IRQn            TA1_0_IRQn
+#define CAP_CCR_IRQHandler      TA1_0_IRQHandler
+#define CAP_CCR                 0               // CCR0 - CCI0A
+#define CAP_LOCK_CCR            2               // CCR2 compare - end of the lockout
+#define CAP_PORT                P8
+#define CAP_PIN                 0x01            // P8.0 - TA1.0
+#define CAP_TAIFG               0x0001          // TAxCTL overflow flag
+#define CAP_TAIE                0x0002          // TAxCTL overflow interrupt enable
+#define CAP_TACLR               0x0004
+#define CAP_MC_CONTINUOUS       0x0020
+#define CAP_TASSEL_SMCLK        0x0200
+#define CAP_CCIFG               0x0001          // TAxCCTLn capture flag
+#define CAP_COV                 0x0002          // capture overflow - an edge lost
+#define CAP_CCIE                0x0010
+#define CAP_CAP                 0x0100          // capture mode
+#define CAP_SCS                 0x0800          // synchronous capture
+#define CAP_CM_FALLING          0x8000
+
+volatile uint32_t Cap_count = 0;
+volatile uint32_t Cap_lost = 0;
+volatile uint32_t Cap_spurious = 0;
+
+//
+// Overflows of the 16 bit count - the upper bits of the capture time
+//
+static volatile uint32_t Cap_hi = 0;
+static uint32_t Cap_last;                       // time of the last edge (SMCLK)
+static uint16_t Cap_span;                       // overflows since the last edge
+static volatile uint8_t Cap_valid = 0;          // Cap_last starts a period
+static volatile uint8_t Cap_scale = 1;          // CAP_TICK_HZ / SMCLK
+static uint32_t Cap_smclk = 0;                  // 0 not started
+static void (*Cap_cb)(uint32_t period) = 0;
+static uint32_t Cap_lock = 0;                   // lockout (CAP_TICK_HZ), 0 none
+static uint32_t Cap_lock_smclk = 0;             // lockout (SMCLK)
+static uint32_t Cap_lock_end;                   // time the lockout ends (SMCLK)
+
+//
+// Local routines
+//
+uint8_t static Cap_clock(uint8_t when, const Clock_freq_t *next);
+void static Cap_arm(void);
+
+////////////////////////////////////////////////////////////////////
+//
+// Cap_Init
+//
+////////////////////////////////////////////////////////////////////
+int Cap_Init(void (*cb)(uint32_t period)){
+    if(Clock_SMCLK_freq == 0 || CAP_TICK_HZ % Clock_SMCLK_freq)
+        return 1;
+
+    CAP_TIMER->CTL = 0;                         // stop
+    Cap_hi = 0;
+    Cap_valid = 0;
+    Cap_scale = CAP_TICK_HZ / Clock_SMCLK_freq;
+    Cap_smclk = Clock_SMCLK_freq;
+    Cap_cb = cb;
+    Cap_lock = 0;
+    Cap_lock_smclk = 0;
+
+    CAP_PORT->SEL0 &= ~CAP_PIN;                 // timer function (10)
+    CAP_PORT->SEL1 |= CAP_PIN;
+    CAP_PORT->DIR &= ~CAP_PIN;
+
+    CAP_TIMER->EX0 = 0;
+    CAP_TIMER->CCTL[CAP_CCR] = CAP_CM_FALLING | CAP_SCS | CAP_CAP | CAP_CCIE;  // CCIxA
+    CAP_TIMER->CCTL[CAP_LOCK_CCR] = 0;
+    CAP_TIMER->CTL = CAP_TASSEL_SMCLK | CAP_TACLR;
+    CAP_TIMER->CTL = CAP_TASSEL_SMCLK | CAP_MC_CONTINUOUS | CAP_TAIE;
+
+    NVIC->ISER[CAP_CCR_IRQn >> 5] = 1UL << (CAP_CCR_IRQn & 0x1F);
+    NVIC->ISER[CAP_TIMER_IRQn >> 5] = 1UL << (CAP_TIMER_IRQn & 0x1F);
+    Clock_notify(Cap_clock);
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Cap_lockout
+//
+////////////////////////////////////////////////////////////////////
+int Cap_lockout(uint32_t ticks){
+    if(ticks > CAP_LOCK_MAX)
+        return 1;
+    Cap_lock = ticks;
+    Cap_lock_smclk = ticks / Cap_scale;
+    return 0;
+}
+
+//
+// Lockout over - edges latched while the capture interrupt was off are
+// thrown away (COV - more than one), the next edge interrupts
+//
+void static Cap_arm(void){
+    uint16_t cctl;
+
+    CAP_TIMER->CCTL[CAP_LOCK_CCR] = 0;
+    cctl = CAP_TIMER->CCTL[CAP_CCR];
+    if(cctl & CAP_CCIFG)
+        Cap_spurious += (cctl & CAP_COV) ? 2 : 1;
+    CAP_TIMER->CCTL[CAP_CCR] &= ~(CAP_CCIFG | CAP_COV);
+    CAP_TIMER->CCTL[CAP_CCR] |= CAP_CCIE;
+}
+
+//
+// SMCLK change - the period in progress is counted at two rates, it only
+// starts the next one. Cleared before (an edge after this starts one at
+// the old rate) and again after
+// A lockout in progress ends - its end time is in the old rate
+//
+uint8_t static Cap_clock(uint8_t when, const Clock_freq_t *next){
+    uint32_t int_state;
+
+    if(Cap_smclk == 0 || next->smclk == Cap_smclk)
+        return 0;
+    if(when == CLOCK_BEFORE){
+        if(CAP_TICK_HZ % next->smclk)
+            return 1;
+        Cap_valid = 0;
+        return 0;
+    }
+    Cap_scale = CAP_TICK_HZ / next->smclk;
+    Cap_smclk = next->smclk;
+    Cap_lock_smclk = Cap_lock / Cap_scale;
+    Cap_valid = 0;
+    int_state = _disable_interrupts();
+    if(!(CAP_TIMER->CCTL[CAP_CCR] & CAP_CCIE))
+        Cap_arm();
+    _restore_interrupts(int_state);
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// TIMER_A1 capture and overflow interrupts
+//
+////////////////////////////////////////////////////////////////////
+//
+// An overflow flag still set with a small capture means the edge came
+// after the overflow - it goes with the next count (as in Time_read)
+// The CCR0 flag clears when its interrupt is taken
+//
+// With a lockout the capture interrupt goes off until CCR2 matches the
+// end time - the match comes every 65536 counts, the overflow count says
+// which one is the end. A lockout short enough to be over already (a late
+// interrupt) re-arms at once
+//
+void CAP_CCR_IRQHandler(void){
+    uint16_t cctl = CAP_TIMER->CCTL[CAP_CCR];
+    uint16_t ccr = CAP_TIMER->CCR[CAP_CCR];
+    uint32_t hi;
+    uint32_t stamp;
+
+    CAP_TIMER->CCTL[CAP_CCR] &= ~(CAP_CCIFG | CAP_COV);
+    hi = Cap_hi;
+    if((CAP_TIMER->CTL & CAP_TAIFG) && ccr < 0x8000)
+        hi++;
+    stamp = (hi << 16) | ccr;
+    if(cctl & CAP_COV){
+        Cap_lost++;
+    }
+    else if(Cap_valid){
+        Cap_count++;
+        if(Cap_cb)
+            Cap_cb((stamp - Cap_last) * Cap_scale);
+    }
+    Cap_last = stamp;
+    Cap_span = 0;
+    Cap_valid = 1;
+
+    if(Cap_lock_smclk){
+        CAP_TIMER->CCTL[CAP_CCR] &= ~CAP_CCIE;
+        Cap_lock_end = stamp + Cap_lock_smclk;
+        CAP_TIMER->CCR[CAP_LOCK_CCR] = (uint16_t)Cap_lock_end;
+        CAP_TIMER->CCTL[CAP_LOCK_CCR] = CAP_CCIE;
+        if(Cap_lock_smclk < 0x8000 && (uint16_t)(CAP_TIMER->R - ccr) >= Cap_lock_smclk)
+            Cap_arm();
+    }
+}
+
+//
+// The count and the flag change together - the capture interrupt must not
+// see one without the other
+// The lockout compare is looked at first - a pending overflow with a small
+// match time is counted in (as for a capture)
+//
+void CAP_TIMER_IRQHandler(void){
+    uint32_t int_state;
+    uint16_t ccr;
+    uint32_t hi;
+
+    if(CAP_TIMER->CCTL[CAP_LOCK_CCR] & CAP_CCIFG){
+        CAP_TIMER->CCTL[CAP_LOCK_CCR] &= ~CAP_CCIFG;
+        ccr = CAP_TIMER->CCR[CAP_LOCK_CCR];
+        hi = Cap_hi;
+        if((CAP_TIMER->CTL & CAP_TAIFG) && ccr < 0x8000)
+            hi++;
+        if((int32_t)(((hi << 16) | ccr) - Cap_lock_end) >= 0)
+            Cap_arm();
+    }
+    if(CAP_TIMER->CTL & CAP_TAIFG){
+        int_state = _disable_interrupts();
+        Cap_hi++;
+        CAP_TIMER->CTL &= ~CAP_TAIFG;
+        _restore_interrupts(int_state);
+        if(++Cap_span >= CAP_SPAN_MAX)
+            Cap_valid = 0;                      // stopped - the next edge starts again
+    }
+}
+
+#endif // __MSOE_LIB_CAP_C__
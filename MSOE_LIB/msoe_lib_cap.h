@@ -0,0 +1,104 @@
+/*
+ * msoe_lib_cap.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     period measurement by TIMER_A input capture
+ *      Rev:    0.2     lockout after each edge - glitch rejection
+ *
+ */
+#ifndef __MSOE_LIB_CAP_H__
+#define __MSOE_LIB_CAP_H__
+////////////////////////////////////////////
+//
+// Input Capture Routines
+//
+// Measures the time between falling edges of a sensor (e.g. one IR pulse
+// per wheel revolution) in hardware - TIMER_A1 counts SMCLK continuously
+// and latches the count in CCR0 on each edge of P8.0 (TA1.0, CCI0A). One
+// interrupt per edge, plus the count overflow (every 65536 SMCLK - 5.5ms
+// at 12MHz) that extends the count to 32 bits
+//
+//      void speed_capture(uint32_t period){ Sched_post(speed_task, period); }
+//
+//      Cap_Init(speed_capture);
+//
+// The routine runs in the interrupt with the period in CAP_TICK_HZ ticks
+// (12MHz - 83ns) whatever SMCLK is - a slower SMCLK (Clock_48MHz_Divide)
+// gives coarser steps of the same unit. The first edge, and the first
+// edge after a clock change, a lost edge or a gap longer than
+// CAP_SPAN_MAX overflows (the wheel stopped) only start a new period
+//
+// Glitches - Cap_lockout sets a shortest period (e.g. from the fastest
+// plausible RPM). Each accepted edge turns the capture interrupt off and
+// CCR2 compare turns it back on when the lockout is over - edges in
+// between (reflections, ambient IR, a bouncing edge) cost no interrupts
+// and are counted in Cap_spurious when the capture is re-armed
+//
+//      Cap_lockout(CAP_RPM_TICKS(10000));  // nothing faster than 10000 RPM
+//
+// TIMER_A1, TA1_0_IRQHandler and TA1_N_IRQHandler belong to the capture
+// CCR1, CCR3 and CCR4 may still be used for compare outputs without
+// interrupts (continuous mode - period 65536)
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Period unit - the SMCLK of Clock_Init_48MHz
+//
+#define CAP_TICK_HZ         12000000UL
+
+//
+// Longest period in timer overflows (22s at 12MHz)
+//
+#define CAP_SPAN_MAX        4096
+
+//
+// Longest lockout (0.5s - 120 RPM), and the lockout for a top speed in
+// revolutions (one edge each) a minute
+//
+#define CAP_LOCK_MAX        (CAP_TICK_HZ / 2)
+#define CAP_RPM_TICKS(rpm)  (60UL * CAP_TICK_HZ / (rpm))
+
+extern volatile uint32_t Cap_count;         // periods reported
+extern volatile uint32_t Cap_lost;          // edges lost - next edge was in before the last was read
+extern volatile uint32_t Cap_spurious;      // lockouts with edges in them - 2 when more than one
+                                            // edge came in (at least that many)
+
+////////////////////////////////////////////////////////////////////
+//
+// Cap_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Starts TIMER_A1 from SMCLK and the capture on P8.0 falling edges
+// Registers with Clock_notify to follow SMCLK changes
+//
+// Inputs: routine called (in the interrupt) with each period
+// Outputs: 0 for success
+//          1 SMCLK does not divide CAP_TICK_HZ (not started)
+//
+int Cap_Init(void (*cb)(uint32_t period));
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Cap_lockout
+//
+////////////////////////////////////////////////////////////////////
+//
+// Edges less than ticks after an accepted edge are ignored - from the
+// next edge on. Cap_Init starts with no lockout
+// The lockout follows SMCLK changes (one in progress ends at the change)
+//
+// Inputs: lockout in CAP_TICK_HZ ticks (0 none, up to CAP_LOCK_MAX)
+// Outputs: 0 for success
+//          1 too long (no change)
+//
+int Cap_lockout(uint32_t ticks);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_CAP_H__
@@ -6,6 +6,14 @@
  *
  *      Rev:    0.1     8/8/17      Added wait states for flash to
  *                                  support production silicon (red boards)
+ *      Rev:    0.2     10/17/26    Publish the clock frequencies and MCLK
+ *                                  cycles per us for the delay routines
+ *      Rev:    0.3     10/17/26    Clock_Init_48MHz as a coroutine - waits
+ *                                  return to the caller
+ *      Rev:    0.4     10/17/26    Boot profile in retained RAM, fast start
+ *                                  from the DCO while HFXT starts
+ *      Rev:    0.5     10/17/26    Clock change notification, core voltage
+ *                                  and flash wait state routines
  */
 #ifndef __MSOE_LIB_CLK_C__
 #define __MSOE_LIB_CLK_C__
@@ -17,11 +25,80 @@
 //
 // Includes
 #include <stdint.h>
+#include <string.h>
 #include "msp432.h"
+#include "msoe_lib_clk.h"
 //
 ////////////////////////////////////////////////////////////////////
 //
-// Clock_Init_48MHz
+// Published clock frequencies
+//
+////////////////////////////////////////////////////////////////////
+//
+// Reset state - DCO at 3MHz for MCLK, HSMCLK and SMCLK
+//
+volatile uint32_t Clock_MCLK_freq = 3000000;
+volatile uint32_t Clock_HSMCLK_freq = 3000000;
+volatile uint32_t Clock_SMCLK_freq = 3000000;
+volatile uint32_t Clock_MCLK_per_us = 3UL << CLOCK_PER_US_SHIFT;
+
+//
+// Record the HFXT (48MHz) divides as shifts (divide by 2^shift)
+// 48MHz / 2^n MHz is exact in 16.16 for n up to 16
+//
+void static Clock_publish(uint8_t mclk_shift, uint8_t hsmclk_shift, uint8_t smclk_shift){
+	Clock_MCLK_freq = 48000000UL >> mclk_shift;
+	Clock_HSMCLK_freq = 48000000UL >> hsmclk_shift;
+	Clock_SMCLK_freq = 48000000UL >> smclk_shift;
+	Clock_MCLK_per_us = (48UL << CLOCK_PER_US_SHIFT) >> mclk_shift;
+}
+//
+// Clock_Init_48MHz_pt state - the timeouts count checks across waits
+//
+static uint32_t Clock_PMR_fail;
+static uint32_t Clock_VCORE1_fail;
+static uint32_t Clock_HFXT_fail;
+static uint32_t Clock_CLK_fail;
+
+#define Clock_pt_return(code)	do{ *result = (code); Clock_boot_done(code); PT_EXIT(pt); } while(0)
+
+//
+// Boot profile - not cleared at reset (no C start up initialization)
+//
+#define CLOCK_BOOT_MAGIC		0x426F6F74		// "Boot"
+#if defined(__TI_COMPILER_VERSION__)
+#pragma NOINIT(Clock_boot)
+Clock_boot_t Clock_boot[2];
+#else
+Clock_boot_t Clock_boot[2] __attribute__((section(".noinit")));
+#endif
+static uint32_t Clock_boot_start;
+
+//
+// Fast start state - Clock_Init_48MHz_pt is finished by the CS interrupt
+//
+#define CLOCK_CS_FCNTHF			0x00000200		// CSIE / CSIFG / CSCLRIFG HFXT start counter
+#define CLOCK_CS_RFCNTHF		0x00000040		// CSCTL3 restart the HFXT start counter
+static Pt_t Clock_fast_pt;
+static int Clock_fast_result;
+
+//
+// Drivers told about clock changes
+//
+static Clock_notify_t Clock_notify_cb[CLOCK_NOTIFY_MAX];
+static uint8_t Clock_notify_n = 0;
+
+//
+// Local routines
+//
+uint8_t static Clock_notify_all(uint8_t when, const Clock_freq_t *next);
+void static Clock_boot_begin(void);
+void static Clock_boot_mark(uint8_t phase);
+void static Clock_boot_done(int result);
+//
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz_pt
 //
 ////////////////////////////////////////////////////////////////////
 //
@@ -54,23 +131,27 @@
 //		5 for HFXT clock stable failure
 //		6 for "some" clock not working
 //
-int Clock_Init_48MHz(void){
-	// Local Variables
+// Each status check that fails returns PT_WAITING (PT_YIELDED in the
+// HFXT check) - the timeouts count checks, as in a busy wait
+// *result is set when the coroutine returns PT_EXITED or PT_ENDED
+//
+uint8_t Clock_Init_48MHz_pt(Pt_t *pt, int *result){
+	PT_BEGIN(pt);
 	// These values are used to timeout the transitions
-	uint32_t PMR_fail = 100000;
-	uint32_t AM_LDO_VCORE1_fail = 500000;
-	uint32_t HFXT_fail = 100000;
-	uint32_t CLK_fail = 100000;
+	// (static - they must survive the waits)
+	Clock_PMR_fail = 100000;
+	Clock_VCORE1_fail = 500000;
+	Clock_HFXT_fail = 100000;
+	Clock_CLK_fail = 100000;
+	Clock_boot_begin();
 
 	// Power mode cannot be changed until the Power Control Module (PCM)
 	// is not active. Status is held in PCMCTL1 register bit 8 (PMR_BUSY)
 	// Power mode can be changed when this bit is zero (idle)
 	// Wait for  PMR to be idle
-	while(PCM->CTL1 & 0x00000100){
-		PMR_fail--;
-		if(PMR_fail == 0)		// Attempt Failed - no changes made - return 1
-			return 1;
-	} // end while
+	PT_WAIT_LIMIT(pt, !(PCM->CTL1 & 0x00000100), Clock_PMR_fail);
+	if(Clock_PMR_fail == 0)		// Attempt Failed - no changes made - return 1
+		Clock_pt_return(1);
 
 	// The Power Control Module requires a special value (Key) to be written to
 	// to change the power mode. Default mode does not support 48MHz operation.
@@ -85,16 +166,15 @@ int Clock_Init_48MHz(void){
 	// PCMIFG bit 2 (AM_INVALID_TR_IFG)
 	if(PCM->IFG & 0x00000004){
 		PCM->CLRIFG = 0x00000004;		// Attempt failed - clear flag and return 2
-        return 2;
+		Clock_pt_return(2);
 	} // end if
 
 	// Check the actual mode, and wait for AM LDO VCORE1 to be set
 	// Status is in PCMCTL0, AM_LDO_VCORE1 mode is 0x01 on bits 13:8
-	while((PCM->CTL0 & 0x00003F00) != 0x00000100){
-		AM_LDO_VCORE1_fail--;
-		if(AM_LDO_VCORE1_fail == 0)
-			return 3;				// Attempt failed - return 3
-	} // end while
+	PT_WAIT_LIMIT(pt, (PCM->CTL0 & 0x00003F00) == 0x00000100, Clock_VCORE1_fail);
+	if(Clock_VCORE1_fail == 0)
+		Clock_pt_return(3);			// Attempt failed - return 3
+	Clock_boot_mark(CLOCK_BOOT_PCM);
 
 	// Power mode change is complete
 	// Clear the change key to prevent unintended changes
@@ -104,11 +184,9 @@ int Clock_Init_48MHz(void){
 	// is not active. Status is held in PCMCTL1 register bit 8 (PMR_BUSY)
 	// Clocks can be changed when this bit is zero (idle)
 	// Wait for  PMR to be idle
-	while(PCM->CTL1 & 0x00000100){
-		PMR_fail--;
-		if(PMR_fail == 0)		// Attempt Failed - return 4
-			return 4;
-	} // end while
+	PT_WAIT_LIMIT(pt, !(PCM->CTL1 & 0x00000100), Clock_PMR_fail);
+	if(Clock_PMR_fail == 0)		// Attempt Failed - return 4
+		Clock_pt_return(4);
 
 	//  Use one wait state for flash to run at 48 MHz
 	//  The wait state value is held in the FLCTL->BANKxRDCTL register
@@ -116,6 +194,7 @@ int Clock_Init_48MHz(void){
 	//  Wait state = 1 requires a code of 0001 (0x1) in bits 15-12
 	FLCTL->BANK0_RDCTL = (FLCTL->BANK0_RDCTL & ~(0x0000F000)) | 0x00001000;
 	FLCTL->BANK1_RDCTL = (FLCTL->BANK0_RDCTL & ~(0x0000F000)) | 0x00001000;
+	Clock_boot_mark(CLOCK_BOOT_FLASH);
 
 	// The crystal oscillator pins default to HFXT mode but the oscillator is not active
 	// until these pins are configured
@@ -142,12 +221,15 @@ int Clock_Init_48MHz(void){
 	// The interrupt flag is set if there is a fault (not stable)
 	// The flag will not clear itself so you need to clear the flag
 	// and re-check - flag:CSIFG bit 1 (HFXTIFG), clearFlag:CSCLRIFG bit 1 (CLR_HFXTIFG)
+	// The crystal takes the longest to start - yield between checks
 	while(CS->IFG & 0x00000002){
 		CS->CLRIFG = 0x00000002;
-		HFXT_fail--;
-		if(HFXT_fail == 0)		// Attempt Failed - return 5
-			return 5;
+		Clock_HFXT_fail--;
+		if(Clock_HFXT_fail == 0)	// Attempt Failed - return 5
+			Clock_pt_return(5);
+		PT_YIELD(pt);
 	} // end while
+	Clock_boot_mark(CLOCK_BOOT_HFXT);
 
 	// Configure the system clocks (CSCTL1)
 	//
@@ -161,6 +243,7 @@ int Clock_Init_48MHz(void){
 	// SMCLK /4 - bits 30:28 = 010	 (max allowed is 12MHz
 	// x010 x000 x001 x000 x001 x010 x101 x101
 	CS->CTL1 = 0x20101255;		// direct write
+	Clock_publish(0, 1, 2);		// 48M-24M-12M
 //	CS->CTL1 = 0x20131255;		// direct write
 
 	// Configure the system clocks
@@ -179,16 +262,229 @@ int Clock_Init_48MHz(void){
 	// xxxx 1111 xxxx 1111 xxxx xxxx xxxx x1xx
 	// normally would test: 0x0F020004
 	//     but with no other peripherals enabled, only MCLK is on, test: 0x0F020004
-	while((CS->STAT & 0x0F020004) != 0x0F020004){
-		CLK_fail--;
-		if(CLK_fail == 0)		// Attempt Failed - return 6
-			return 6;			// some clock not working
-	}
+	PT_WAIT_LIMIT(pt, (CS->STAT & 0x0F020004) == 0x0F020004, Clock_CLK_fail);
+	if(Clock_CLK_fail == 0)		// Attempt Failed - return 6
+		Clock_pt_return(6);		// some clock not working
 	//
 
-	return 0;				// change completed
+	*result = 0;			// change completed
+	Clock_boot_done(0);
+	PT_END(pt);
+} // end Clock_Init_48MHz_pt
+
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz
+//
+////////////////////////////////////////////////////////////////////
+//
+// Runs Clock_Init_48MHz_pt to the end
+//
+int Clock_Init_48MHz(void){
+	Pt_t pt;
+	int result;
+
+	PT_INIT(&pt);
+	while(PT_SCHEDULE(Clock_Init_48MHz_pt(&pt, &result)))
+		;
+	return result;
 } // end Clock_Init_48MHz
 
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz_fast
+//
+////////////////////////////////////////////////////////////////////
+//
+// Runs the bring-up to the crystal wait. If the crystal is not yet stable
+// the CPU carries on from the DCO at 12MHz and the CS interrupt finishes
+// the bring-up when the HFXT start counter runs out without a fault
+// SMCLK is 12MHz on the DCO and on HFXT - SMCLK timing does not change at
+// the switch
+//
+int Clock_Init_48MHz_fast(void){
+	uint8_t r;
+
+	PT_INIT(&Clock_fast_pt);
+	do{
+		r = Clock_Init_48MHz_pt(&Clock_fast_pt, &Clock_fast_result);
+	} while(r == PT_WAITING);
+	if(r != PT_YIELDED)				// crystal was already stable, or failed
+		return Clock_fast_result;
+
+	// Still in the crystal wait - the CS key is open
+	// DCO range 3 (nominal 12MHz) for MCLK, HSMCLK and SMCLK (/1)
+	// ACLK and BCLK from REFOCLK as in Clock_Init_48MHz
+	// x000 x000 x000 x000 x001 x010 x011 x011
+	CS->CTL0 = 0x00030000;
+	CS->CTL1 = 0x00001233;
+	Clock_publish(2, 2, 2);			// 12M-12M-12M
+
+	CS->CLRIFG = CLOCK_CS_FCNTHF;
+	CS->CTL3 |= CLOCK_CS_RFCNTHF;	// count from now
+	CS->IE |= CLOCK_CS_FCNTHF;
+	CS->KEY = 0;
+	NVIC->ISER[CS_IRQn >> 5] = 1UL << (CS_IRQn & 0x1F);
+	return 0;
+} // end Clock_Init_48MHz_fast
+
+////////////////////////////////////////////////////////////////////
+//
+// CS interrupt - fast start
+//
+////////////////////////////////////////////////////////////////////
+//
+// The HFXT start counter ran out - one more crystal check
+//      no fault - switch to HFXT and finish the bring-up
+//      a fault - restart the counter and wait for the next interrupt
+// A crystal that never starts (Clock_Init_48MHz return 5) leaves the
+// CPU on the DCO
+// The registered drivers (Clock_notify) are told after the switch
+//
+void CS_IRQHandler(void){
+	uint8_t r;
+
+	CS->KEY = 0x695A;
+	CS->CLRIFG = CLOCK_CS_FCNTHF;
+	do{
+		r = Clock_Init_48MHz_pt(&Clock_fast_pt, &Clock_fast_result);
+	} while(r == PT_WAITING);		// clocks ready wait after the switch
+
+	CS->KEY = 0x695A;
+	if(r == PT_YIELDED){
+		CS->CTL3 |= CLOCK_CS_RFCNTHF;
+		CS->KEY = 0;
+		return;
+	}
+	CS->IE &= ~CLOCK_CS_FCNTHF;
+	CS->KEY = 0;
+	Clock_notify_all(CLOCK_AFTER, 0);	// MCLK changed (SMCLK did not)
+} // end CS_IRQHandler
+
+////////////////////////////////////////////////////////////////////
+//
+// Clock_VCORE_set / Clock_flash_wait
+//
+////////////////////////////////////////////////////////////////////
+//
+// Same PCM sequence as Clock_Init_48MHz - wait for PMR idle, keyed write
+// of the active mode request (AMR bits 3:0), check for an invalid
+// transition, wait for the current mode (CPM bits 13:8) to follow
+// AM_LDO_VCORE0 is mode 0, AM_LDO_VCORE1 is mode 1
+//
+int Clock_VCORE_set(uint8_t vcore){
+	uint32_t PMR_fail = 100000;
+	uint32_t VCORE_fail = 500000;
+	uint32_t mode = vcore ? 0x00000001 : 0x00000000;
+
+	while(PCM->CTL1 & 0x00000100){
+		PMR_fail--;
+		if(PMR_fail == 0)
+			return 1;
+	}
+	PCM->CTL0 = (PCM->CTL0 & ~0xFFFF000F) | 0x695A0000 | mode;
+	if(PCM->IFG & 0x00000004){
+		PCM->CLRIFG = 0x00000004;
+		return 2;
+	}
+	while((PCM->CTL0 & 0x00003F00) != (mode << 8)){
+		VCORE_fail--;
+		if(VCORE_fail == 0)
+			return 3;
+	}
+	PCM->CTL1 &= ~0xFFFF0000;
+	return 0;
+}
+
+void Clock_flash_wait(uint8_t states){
+	FLCTL->BANK0_RDCTL = (FLCTL->BANK0_RDCTL & ~(0x0000F000)) | ((uint32_t)(states & 0xF) << 12);
+	FLCTL->BANK1_RDCTL = (FLCTL->BANK1_RDCTL & ~(0x0000F000)) | ((uint32_t)(states & 0xF) << 12);
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Clock_notify
+//
+////////////////////////////////////////////////////////////////////
+//
+// Registering the same routine again does nothing
+//
+uint8_t Clock_notify(Clock_notify_t cb){
+	uint8_t i;
+
+	for(i=0; i<Clock_notify_n; i++)
+		if(Clock_notify_cb[i] == cb)
+			return 0;
+	if(Clock_notify_n == CLOCK_NOTIFY_MAX)
+		return 1;
+	Clock_notify_cb[Clock_notify_n++] = cb;
+	return 0;
+}
+
+//
+// Every driver is called, even after one refuses, so each can undo its
+// preparation on the CLOCK_AFTER that follows
+// next 0 - the current (published) frequencies
+//
+uint8_t static Clock_notify_all(uint8_t when, const Clock_freq_t *next){
+	Clock_freq_t now;
+	uint8_t refused = 0;
+	uint8_t i;
+
+	if(next == 0){
+		now.mclk = Clock_MCLK_freq;
+		now.hsmclk = Clock_HSMCLK_freq;
+		now.smclk = Clock_SMCLK_freq;
+		next = &now;
+	}
+	for(i=0; i<Clock_notify_n; i++)
+		refused |= Clock_notify_cb[i](when, next);
+	return refused;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Boot profile
+//
+////////////////////////////////////////////////////////////////////
+//
+// A valid record from before a reset moves to Clock_boot[1]
+// The DWT cycle counter times the phases (it is left running)
+//
+void static Clock_boot_begin(void){
+	if(Clock_boot[0].magic == CLOCK_BOOT_MAGIC){
+		Clock_boot[1] = Clock_boot[0];
+		Clock_boot[0].boots++;
+	}
+	else{
+		memset(Clock_boot, 0, sizeof(Clock_boot));
+		Clock_boot[0].magic = CLOCK_BOOT_MAGIC;
+		Clock_boot[0].boots = 1;
+	}
+	Clock_boot[0].result = -1;
+	memset(Clock_boot[0].cycles, 0, sizeof(Clock_boot[0].cycles));
+	CoreDebug->DEMCR |= 0x01000000;	// TRCENA
+	DWT->CTRL |= 0x00000001;		// CYCCNTENA
+	Clock_boot_start = DWT->CYCCNT;
+}
+
+void static Clock_boot_mark(uint8_t phase){
+	Clock_boot[0].cycles[phase] = DWT->CYCCNT - Clock_boot_start;
+}
+
+//
+// Checks are the timeout counts used
+//
+void static Clock_boot_done(int result){
+	if(result == 0)
+		Clock_boot_mark(CLOCK_BOOT_READY);
+	Clock_boot[0].pmr_checks = 100000 - Clock_PMR_fail;
+	Clock_boot[0].vcore_checks = 500000 - Clock_VCORE1_fail;
+	Clock_boot[0].hfxt_checks = 100000 - Clock_HFXT_fail;
+	Clock_boot[0].clk_checks = 100000 - Clock_CLK_fail;
+	Clock_boot[0].result = result;
+}
+
 ////////////////////////////////////////////////////////////////////
 
 ////////////////////////////////////////////////////////////////////
@@ -206,30 +502,21 @@ int Clock_Init_48MHz(void){
 //
 // Inputs: Divide value
 // Outputs: none
+// The registered drivers (Clock_notify) are told before and after
+//
 // Returns:	0 for success
 //			1 for Power mode change failure
 //			2 for "some" clock not working
+//			3 for a driver refused the change (no change made)
 //
 int Clock_48MHz_Divide(uint8_t divider){
 	// Local Variables
 	// These values are used to timeout the transitions
 	uint32_t PMR_fail = 100000;
 	uint32_t CLK_fail = 100000;
-
-	// Clocks cannot be changed until the Power Control Module (PCM)
-	// is not active. Status is held in PCMCTL1 register bit 8 (PMR_BUSY)
-	// Clocks can be changed when this bit is zero (idle)
-	// Wait for  PMR to be idle
-	while(PCM->CTL1 & 0x00000100){
-		PMR_fail--;
-		if(PMR_fail == 0)		// Attempt Failed - return 1
-			return 1;
-	} // end while
-
-	// The Clock Source module requires a special value (Key) to be written to
-	// to change the clock source. Default DCO mode does not support 48MHz operation.
-	// Key is 0x695A (top bits are reserved) and loads into CSKEY
-	CS->KEY = 0x695A;
+	uint32_t ctl1;
+	uint8_t shift;
+	Clock_freq_t next;
 
 	// Configure the clock dividers (CSCTL1)
 	//
@@ -240,32 +527,64 @@ int Clock_48MHz_Divide(uint8_t divider){
 	// x010 x000 x001 x000 x000 x010 x101 x101
 	switch(divider){
 	case 1:							// Mclk - HSMCLK - ACLK - SMCLK
-		CS->CTL1 = 0x20100255;		// 48M-24M-32K-12M
+		ctl1 = 0x20100255;			// 48M-24M-32K-12M
 		break;
 	case 2:
-		CS->CTL1 = 0x30210255;		// 24M-12M-32K-6M
+		ctl1 = 0x30210255;			// 24M-12M-32K-6M
 		break;
 	case 4:
-		CS->CTL1 = 0x40320255;		// 12M-6M-32K-3M
+		ctl1 = 0x40320255;			// 12M-6M-32K-3M
 		break;
 	case 8:
-		CS->CTL1 = 0x50430255;		// 6M-3M-32K-1.5M
+		ctl1 = 0x50430255;			// 6M-3M-32K-1.5M
 		break;
 	case 16:
-		CS->CTL1 = 0x60540255;		// 3M-1.5M-32K-750K
+		ctl1 = 0x60540255;			// 3M-1.5M-32K-750K
 		break;
 	case 32:
-		CS->CTL1 = 0x70650255;		// 1.5M-750M-32K-375K
+		ctl1 = 0x70650255;			// 1.5M-750M-32K-375K
 		break;
 	case 64:
-		CS->CTL1 = 0x70760255;		// 750K-375K-32K-375K
+		ctl1 = 0x70760255;			// 750K-375K-32K-375K
 		break;
 	case 128:
-		CS->CTL1 = 0x70770255;		// 375K-375K-32K-375K
+		ctl1 = 0x70770255;			// 375K-375K-32K-375K
 		break;
 	default:
-		CS->CTL1 = 0x20100255;		// 48M-24M-32K-12M
+		ctl1 = 0x20100255;			// 48M-24M-32K-12M
 	}
+	// The divider fields are shifts - MCLK bits 18:16, HSMCLK 22:20, SMCLK 30:28
+	shift = (ctl1 >> 16) & 0x7;
+	next.mclk = 48000000UL >> shift;
+	next.hsmclk = 48000000UL >> ((ctl1 >> 20) & 0x7);
+	next.smclk = 48000000UL >> ((ctl1 >> 28) & 0x7);
+
+	// Drivers that depend on the clocks get ready - any of them can
+	// refuse (busy, or cannot run at the new frequency)
+	if(Clock_notify_all(CLOCK_BEFORE, &next)){
+		Clock_notify_all(CLOCK_AFTER, 0);	// undo any preparation
+		return 3;
+	}
+
+	// Clocks cannot be changed until the Power Control Module (PCM)
+	// is not active. Status is held in PCMCTL1 register bit 8 (PMR_BUSY)
+	// Clocks can be changed when this bit is zero (idle)
+	// Wait for  PMR to be idle
+	while(PCM->CTL1 & 0x00000100){
+		PMR_fail--;
+		if(PMR_fail == 0){		// Attempt Failed - return 1
+			Clock_notify_all(CLOCK_AFTER, 0);
+			return 1;
+		}
+	} // end while
+
+	// The Clock Source module requires a special value (Key) to be written to
+	// to change the clock source. Default DCO mode does not support 48MHz operation.
+	// Key is 0x695A (top bits are reserved) and loads into CSKEY
+	CS->KEY = 0x695A;
+
+	CS->CTL1 = ctl1;
+	Clock_publish(shift, (ctl1 >> 20) & 0x7, (ctl1 >> 28) & 0x7);
 
 	// Clock mode change is complete
 	// Clear the change key to prevent unintended changes
@@ -281,11 +600,12 @@ int Clock_48MHz_Divide(uint8_t divider){
 	while((CS->STAT & 0x0F020004) != 0x0F020004){
 		CLK_fail--;
 		if(CLK_fail == 0)		// Attempt Failed - return 2
-			return 2;			// some clock not working
+			break;				// some clock not working
 	}
+	Clock_notify_all(CLOCK_AFTER, 0);
 	//
 
-	return 0;				// change completed
+	return CLK_fail == 0 ? 2 : 0;	// change completed
 } // end Clock_48MHz_Divide
 
 /////////////////////////////////////////////////////////////////////////
@@ -6,6 +6,11 @@
  *
  *      Rev:    0.1     8/8/17      Added wait states for flash to
  *                                  support production silicon (red boards)
+ *      Rev:    0.2     10/17/26    Publish the clock frequencies and MCLK
+ *                                  cycles per us for the delay routines
+ *      Rev:    0.3     10/17/26    Clock_Init_48MHz_pt coroutine
+ *      Rev:    0.4     10/17/26    Boot profile, Clock_Init_48MHz_fast
+ *      Rev:    0.5     10/17/26    Clock_notify, Clock_VCORE_set, Clock_flash_wait
  *
  */
 ////////////////////////////////////////////
@@ -17,7 +22,30 @@
 #define __MSOE_LIB_CLK_H__
 //
 // Includes
-// None required
+#include <stdint.h>
+#include "msoe_lib_pt.h"
+
+////////////////////////////////////////////////////////////////////
+//
+// Published clock frequencies
+//
+////////////////////////////////////////////////////////////////////
+//
+// Current clock frequencies in Hz - reset values (3MHz DCO) until
+// Clock_Init_48MHz, updated by Clock_48MHz_Divide
+// Read only - the delay routines (Delay_MCLK_xx) use these to stay correct
+// when the clock is divided at run time
+//
+// Clock_MCLK_per_us is MCLK cycles per us in 16.16 fixed point
+//      48MHz -> 48 << 16, 375KHz -> 0.375 * 65536 = 24576
+//      cycles = (val_us * Clock_MCLK_per_us) >> CLOCK_PER_US_SHIFT
+//
+#define CLOCK_PER_US_SHIFT	16
+
+extern volatile uint32_t Clock_MCLK_freq;
+extern volatile uint32_t Clock_HSMCLK_freq;
+extern volatile uint32_t Clock_SMCLK_freq;
+extern volatile uint32_t Clock_MCLK_per_us;
 
 ////////////////////////////////////////////////////////////////////
 //
@@ -54,6 +82,92 @@
 //
 int Clock_Init_48MHz(void);
 
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz_pt
+//
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz as a coroutine (msoe_lib_pt.h) - returns to the caller
+// on each status check that is not yet done (PCM busy, VCORE1 transition,
+// HFXT start up, clocks ready) so other bring-up can run in between
+// The timeouts count checks, as in Clock_Init_48MHz
+// Only one bring-up at a time (the timeouts are static)
+//
+//      Pt_t clk;
+//      int clk_result;
+//      PT_INIT(&clk);
+//      while(PT_SCHEDULE(Clock_Init_48MHz_pt(&clk, &clk_result)) | ...)
+//          ;
+//
+// Inputs: coroutine state, where to put the result
+// Outputs: *result - Clock_Init_48MHz return value, set on the last call
+// Returns: PT_WAITING or PT_YIELDED - call again
+//          PT_ENDED success, PT_EXITED failure (*result 1 to 6)
+//
+uint8_t Clock_Init_48MHz_pt(Pt_t *pt, int *result);
+
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz_fast
+//
+////////////////////////////////////////////////////////////////////
+//
+// Clock_Init_48MHz without waiting for the crystal - while HFXT starts
+// the CPU runs from the DCO at 12MHz (MCLK, HSMCLK and SMCLK) and the CS
+// interrupt (CS_IRQHandler) switches to the Clock_Init_48MHz clocks once
+// the crystal has run for its start count without a fault
+// The published frequencies follow the switch
+//
+// Needs interrupts enabled to finish - Clock_boot[0].result is -1 until
+// then, and the Clock_Init_48MHz return value after
+// Do not call Clock_48MHz_Divide before the switch
+//
+// Inputs: none
+// Outputs: none
+// Returns: 0 running (from the DCO until the switch, or on HFXT if the
+//          crystal was already stable)
+//          1 to 4 as Clock_Init_48MHz (still at 3MHz)
+//          6 as Clock_Init_48MHz
+//
+int Clock_Init_48MHz_fast(void);
+
+////////////////////////////////////////////////////////////////////
+//
+// Boot profile
+//
+////////////////////////////////////////////////////////////////////
+//
+// Every Clock_Init_48MHz (any form) records when each step finished and
+// how many status checks each wait took, in RAM that is not cleared at
+// reset - the record of the boot before a reset (watchdog, debugger
+// restart) is still there in Clock_boot[1]
+//
+// Times are DWT cycles (CYCCNT, left running) from the start of the
+// bring-up - MCLK cycles, 3MHz (12MHz fast start) until the switch to
+// HFXT and 48MHz after. 0 - step not reached
+// Checks are the timeout budget used - PMR (both waits) of 100000,
+// VCORE1 of 500000, HFXT and clocks ready of 100000
+//
+#define CLOCK_BOOT_PCM		0			// AM_LDO_VCORE1 reached
+#define CLOCK_BOOT_FLASH	1			// flash wait states set
+#define CLOCK_BOOT_HFXT		2			// crystal stable
+#define CLOCK_BOOT_READY	3			// clocks ready - done
+#define CLOCK_BOOT_PHASES	4
+
+typedef struct {
+	uint32_t magic;						// record is valid
+	uint32_t boots;						// bring-ups since power up
+	int32_t result;						// Clock_Init_48MHz return, -1 running
+	uint32_t cycles[CLOCK_BOOT_PHASES];
+	uint32_t pmr_checks;
+	uint32_t vcore_checks;
+	uint32_t hfxt_checks;
+	uint32_t clk_checks;
+} Clock_boot_t;
+
+extern Clock_boot_t Clock_boot[2];		// [0] this boot, [1] the one before
+
 ////////////////////////////////////////////////////////////////////
 //
 // Clock_48MHz_Divide
@@ -67,14 +181,79 @@ int Clock_Init_48MHz(void);
 // This routine assumes the 48MHz clock has already been set up
 // using Clock_Init_48MHz()
 //
+// The drivers registered with Clock_notify are told before the change
+// (and can refuse it) and after
+// MCLK above 24MHz needs VCORE1 and 1 flash wait state, above 12MHz 1
+// wait state (Clock_VCORE_set, Clock_flash_wait - see msoe_lib_gov)
+//
 // Inputs: Divide value
 // Outputs: none
 // Returns: 0 for success
 //          1 for Power mode change failure
 //          2 for "some" clock not working
+//          3 for a driver refused the change (no change made)
 //
 int Clock_48MHz_Divide(uint8_t divider);
 
+////////////////////////////////////////////////////////////////////
+//
+// Clock_notify
+//
+////////////////////////////////////////////////////////////////////
+//
+// Registers a driver routine called around every clock change
+// (Clock_48MHz_Divide, and the switch to HFXT after Clock_Init_48MHz_fast)
+//
+//      when CLOCK_BEFORE - next holds the new frequencies, Clock_xxx_freq
+//          the old. Return 1 to refuse (busy, or the driver cannot work at
+//          the new frequency) - nothing is changed. A driver whose timing
+//          gets faster (e.g. a SPI clock limit) adjusts here
+//      when CLOCK_AFTER - the change is done (or was refused) - next and
+//          Clock_xxx_freq hold the frequencies now. Return 0
+//
+// The before call is not made for the fast start switch (an interrupt)
+// Routines run in the caller's context
+//
+// Inputs: driver routine
+// Outputs: none
+// Returns: 0 registered (or already registered), 1 no room
+//
+#define CLOCK_NOTIFY_MAX	6
+#define CLOCK_BEFORE		0
+#define CLOCK_AFTER			1
+
+typedef struct {
+	uint32_t mclk;
+	uint32_t hsmclk;
+	uint32_t smclk;
+} Clock_freq_t;
+
+typedef uint8_t (*Clock_notify_t)(uint8_t when, const Clock_freq_t *next);
+
+uint8_t Clock_notify(Clock_notify_t cb);
+
+////////////////////////////////////////////////////////////////////
+//
+// Clock_VCORE_set / Clock_flash_wait
+//
+////////////////////////////////////////////////////////////////////
+//
+// Clock_VCORE_set - core voltage through the LDO, 0 AM_LDO_VCORE0 (MCLK up
+// to 24MHz), 1 AM_LDO_VCORE1 (up to 48MHz)
+// Raise the voltage before raising MCLK, lower it after lowering MCLK
+// Clock_flash_wait - flash read wait states for both banks
+// VCORE0 - 0 up to 12MHz, 1 up to 24MHz. VCORE1 - 1 up to 48MHz
+//
+// Inputs: 0 or 1 / wait states
+// Outputs: none
+// Returns: 0 for success
+//          1 for Power mode change failure (no change made)
+//          2 for Active mode failure (invalid transition)
+//          3 for VCORE node failure
+//
+int Clock_VCORE_set(uint8_t vcore);
+void Clock_flash_wait(uint8_t states);
+
 /////////////////////////////////////////////////////////////////////////
 #endif // __MSOE_LIB_CLK_C__
 
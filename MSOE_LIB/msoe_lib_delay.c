@@ -8,6 +8,15 @@
  *          Changed the 48MHz delay ms function to use a loop to increase flexibility
  *      Version 1.2 - 7/23/2018
  *          Removed some of the clk cycle added delay to account for small inputs
+ *      Version 1.4 - 10/17/2026
+ *          Added low power delays (LPM0 / LPM3 with WFI on TIMER_A3)
+ *          and sleep accounting
+ *      Version 1.5 - 10/17/2026
+ *          Added delays that follow the published MCLK (msoe_lib_clk)
+ *          Integer only cycle counts, SysTick reloads chained past 24 bits
+ *      Version 1.6 - 10/17/2026
+ *          Bad input is reported to msoe_lib_err (no delay, returns 1)
+ *          instead of printf / exit - no stdio
  */
 #ifndef __MSOE_LIB_DELAY_C__
 #define __MSOE_LIB_DELAY_C__
@@ -16,14 +25,21 @@
 // Delay Routines
 // us, ms, sec delay functions for 3Mhz and 48Mhz operation
 // us, ms, sec delay function for parameterized frequency operation
+// us, ms, sec delay functions for the current MCLK (follows Clock_48MHz_Divide)
 //
 ////////////////////////////////////////////
 //
 // Includes
-#include <stdio.h>
-#include <stdlib.h>
 #include <stdint.h>
 #include "msp432.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_err.h"
+#include "msoe_lib_delay.h"
+//
+//
+// Local routines
+//
+void static Delay_cycles(uint64_t cycles);
 //
 ////////////////////////////////////////////////////////////////////
 //
@@ -36,7 +52,8 @@
 // maximum delay ~0.349s
 /////////////////////////////////////
 //
-// This assumes the MSP432 has been programmed to 48MHz
+// This assumes the MSP432 has been programmed to 48MHz by Clock_Init_48MHz
+// The delay follows Clock_48MHz_Divide - see Delay_MCLK_us
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -55,34 +72,13 @@ int Delay_48MHz_us(uint32_t val){
 	// input checking
     // max input is 349,524
     if (val > 349524){
-        printf("\nDelay_48MHz_us delay out of bounds %i\n", val);
-        exit(1);
+        Err_report(ERR_DELAY_48MHZ_US, val);
+        return 1;
     }
 
-    // Local Variables
-	// These values are used to timeout the transitions
-	uint32_t delay_cnt;
-
-	// Calculate the required number of clock cycles
-	// 48MHz --> 20.8333ns/clk
-	// # of clocks per us = 1e-6 * 48e6 = 48
-	// required number of clocks = val * clks/us
-	// Characterization has shown approx 50 clks used for overhead @48MHz
-	//     subtract this from the delay count
-	// removed the 50 clock correction to provide small delay values 7/23/18 tj
-	delay_cnt = val * 48;
-
-	// Setup the systick timer
-	SysTick->CTRL = 0x0005;     // set clk to CPU clk (bit 2) and enable (bit 0)
-	SysTick->LOAD = delay_cnt;
-	SysTick->VAL = 0x0;
-
-	// Wait
-    while(!(SysTick->CTRL & 0x00010000))
-	    ;
-
-	// Done waiting
-	return 0;
+    // Clock_48MHz_Divide may have slowed MCLK - count at the published MCLK
+    // 48MHz --> 48 clocks per us
+    return Delay_MCLK_us(val);
 } // end Delay_48MHz_us
 
 ////////////////////////////////////////////////////////////////////
@@ -98,7 +94,8 @@ int Delay_48MHz_us(uint32_t val){
 // maximum delay 65,535 ms
 /////////////////////////////////////
 //
-// This assumes the MSP432 has been programmed to 48MHz
+// This assumes the MSP432 has been programmed to 48MHz by Clock_Init_48MHz
+// The delay follows Clock_48MHz_Divide - see Delay_MCLK_us
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -115,38 +112,12 @@ int Delay_48MHz_us(uint32_t val){
 int Delay_48MHz_ms(uint16_t val){
 
     // input checking
-    // max input is 65,535
-    if (val > 65535){
-        printf("\nDelay_48MHz_ms delay out of bounds %i\n", val);
-        exit(1);
-    }
-
-    // Local Variables
-    // These values are used to timeout the transitions
-    uint16_t delay_cnt;
-    uint16_t i;
-
-    // Calculate the required number of clock cycles
-    // 48MHz --> 20.8333ns/clk
-    // # of clocks per 1ms = 1e-3 * 48e6 = 48000
-    // required number of clocks = val * clks/1ms
-    // Characterization has shown approx 50 clks used for overhead @48MHz
-    //     subtract this from the delay count
-    // removed the 50 clock correction to provide small delay values 7/23/18 tj
-    delay_cnt = 48000;
-
-    // Setup the systick timer
-    SysTick->CTRL = 0x0005;     // set clk to CPU clk (bit 2) and enable (bit 0)
-    SysTick->VAL = 0x0;
+    // max input is 65,535 - the uint16_t argument, larger constants
+    // do not compile (ERR_RANGE)
 
-    // Wait
-    for(i = 0; i < val; i++){
-        SysTick->LOAD = delay_cnt;
-        while(!(SysTick->CTRL & 0x00010000))
-        ;
-    }
-    // Done waiting
-    return 0;
+    // Clock_48MHz_Divide may have slowed MCLK - count at the published MCLK
+    // 48MHz --> 48000 clocks per ms
+    return Delay_MCLK_ms(val);
 } // end Delay_48MHz_ms
 
 ////////////////////////////////////////////////////////////////////
@@ -162,7 +133,8 @@ int Delay_48MHz_ms(uint16_t val){
 // maximum delay 21s
 /////////////////////////////////////
 //
-// This assumes the MSP432 has been programmed to 48MHz
+// This assumes the MSP432 has been programmed to 48MHz by Clock_Init_48MHz
+// The delay follows Clock_48MHz_Divide - see Delay_MCLK_us
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -181,37 +153,13 @@ int Delay_48MHz_sec(uint8_t val){
     // input checking
     // max input is 21
     if (val > 21){
-        printf("\nDelay_48MHz_sec delay out of bounds %i\n", val);
-        exit(1);
+        Err_report(ERR_DELAY_48MHZ_SEC, val);
+        return 1;
     }
 
-    // Local Variables
-    // These values are used to timeout the transitions
-    uint32_t delay_cnt;
-    uint8_t i;
-
-    // Calculate the required number of clock cycles
-    // 48MHz --> 20.8333ns/clk
-    // # of clocks per 100ms = 1e-1 * 48e6 = 4800000
-    // required number of clocks = val * clks/100ms
-    // Characterization has shown approx 50 clks used for overhead @48MHz
-    //     subtract this from the delay count
-    // removed the 50 clock correction to provide small delay values 7/23/18 tj
-    delay_cnt = 4800000;
-
-    // Setup the systick timer
-    SysTick->CTRL = 0x0005;     // set clk to CPU clk (bit 2) and enable (bit 0)
-//    SysTick->LOAD = delay_cnt;
-    SysTick->VAL = 0x0;
-
-    // Wait
-    for(i = 0; i < val*10; i++){
-        SysTick->LOAD = delay_cnt;
-        while(!(SysTick->CTRL & 0x00010000))
-        ;
-    }
-    // Done waiting
-    return 0;
+    // Clock_48MHz_Divide may have slowed MCLK - count at the published MCLK
+    // 48MHz --> 48000000 clocks per s
+    return Delay_MCLK_sec(val);
 } // end Delay_48MHz_sec
 
 ////////////////////////////////////////////////////////////////////
@@ -251,12 +199,12 @@ int Delay_3MHz_us(uint32_t val){
     // input checking
     // max input is 5,529,405, min unput is 33
     if (val > 5529405){
-        printf("\nDelay_3MHz_us delay out of bounds high %i\n", val);
-        exit(1);
+        Err_report(ERR_DELAY_3MHZ_US, val);
+        return 1;
     }
     else if (val < 33){
-        printf("\nDelay_3MHz_us delay out of bounds low %i\n", val);
-        exit(1);
+        Err_report(ERR_DELAY_3MHZ_US, val);
+        return 1;
     }
 
     // Local Variables
@@ -316,8 +264,8 @@ int Delay_3MHz_ms(uint32_t val){
     // input checking
     // max input is 5,529
     if (val > 5529){
-        printf("\nDelay_3MHz_ms delay out of bounds %i\n", val);
-        exit(1);
+        Err_report(ERR_DELAY_3MHZ_MS, val);
+        return 1;
     }
 
     // Local Variables
@@ -377,8 +325,8 @@ int Delay_3MHz_sec(uint32_t val){
     // input checking
     // max input is 255
     if (val > 255){
-        printf("\nDelay_3MHz_sec delay out of bounds high %i\n", val);
-        exit(1);
+        Err_report(ERR_DELAY_3MHZ_SEC, val);
+        return 1;
     }
 
     // Local Variables
@@ -420,10 +368,11 @@ int Delay_3MHz_sec(uint32_t val){
 ////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////
-// maximum input value = dependent on frequency
+// maximum input value = 2^32 - 1
 /////////////////////////////////////
 //
 // This assumes the MSP432 has been programmed to a known value
+// Delays longer than 2^24 clocks chain SysTick reloads
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -440,24 +389,12 @@ int Delay_3MHz_sec(uint32_t val){
 //
 int Delay_us(uint32_t val, uint32_t freq){
 
-    // Local Variables
-    // These values are used to timeout the transitions
-    uint32_t delay_cnt;
-
     // Calculate the required number of clock cycles
     // freq  --> freq s/clk
     // # of clocks per us = 1e-6 * freq
     // required number of clocks = val * clks/us
-    delay_cnt = val * (freq * 1e-6) ;
-
-    // Setup the systick timer
-    SysTick->CTRL = 0x0005;     // set clk to CPU clk (bit 2) and enable (bit 0)
-    SysTick->LOAD = delay_cnt;
-    SysTick->VAL = 0x0;
-
-    // Wait
-    while(!(SysTick->CTRL & 0x00010000))
-        ;
+    // 64 bit integer math - no float, no overflow
+    Delay_cycles((uint64_t)val * freq / 1000000);
 
     // Done waiting
     return 0;
@@ -472,10 +409,11 @@ int Delay_us(uint32_t val, uint32_t freq){
 ////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////
-// maximum input value = dependent on frequency
+// maximum input value = 2^32 - 1
 /////////////////////////////////////
 //
 // This assumes the MSP432 has been programmed to a known value
+// Delays longer than 2^24 clocks chain SysTick reloads
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -492,24 +430,12 @@ int Delay_us(uint32_t val, uint32_t freq){
 //
 int Delay_ms(uint32_t val, uint32_t freq){
 
-    // Local Variables
-    // These values are used to timeout the transitions
-    uint32_t delay_cnt;
-
     // Calculate the required number of clock cycles
     // freq  --> freq s/clk
     // # of clocks per ms = 1e-3 * freq
     // required number of clocks = val * clks/ms
-    delay_cnt = val * (freq * 1e-3) ;
-
-    // Setup the systick timer
-    SysTick->CTRL = 0x0005;     // set clk to CPU clk (bit 2) and enable (bit 0)
-    SysTick->LOAD = delay_cnt;
-    SysTick->VAL = 0x0;
-
-    // Wait
-    while(!(SysTick->CTRL & 0x00010000))
-        ;
+    // 64 bit integer math - no float, no overflow
+    Delay_cycles((uint64_t)val * freq / 1000);
 
     // Done waiting
     return 0;
@@ -524,10 +450,11 @@ int Delay_ms(uint32_t val, uint32_t freq){
 ////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////
-// maximum input value = dependent on frequency
+// maximum input value = 2^32 - 1
 /////////////////////////////////////
 //
 // This assumes the MSP432 has been programmed to a known value
+// Delays longer than 2^24 clocks chain SysTick reloads
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -544,28 +471,256 @@ int Delay_ms(uint32_t val, uint32_t freq){
 //
 int Delay_sec(uint32_t val, uint32_t freq){
 
-    // Local Variables
-    // These values are used to timeout the transitions
-    uint32_t delay_cnt;
-
     // Calculate the required number of clock cycles
     // freq  --> freq s/clk
-    // # of clocks per sec =  freq
+    // # of clocks per sec = freq
     // required number of clocks = val * clks/sec
-    delay_cnt = val * (freq) ;
+    // 64 bit integer math - no float, no overflow
+    Delay_cycles((uint64_t)val * freq);
+
+    // Done waiting
+    return 0;
+} // end Delay_sec
+
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_MCLK_us / Delay_MCLK_ms / Delay_MCLK_sec
+//
+////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////
+// maximum input value = 2^32 - 1
+/////////////////////////////////////
+//
+// Same SysTick wait as Delay_us, at the MCLK published by the clock module
+// (Clock_Init_48MHz, Clock_48MHz_Divide) - no frequency to pass, integer only
+//
+// cycles = val * Clock_MCLK_per_us (16.16) - one 32x32->64 multiply
+//
+// Inputs: delay time in us, ms or sec
+// Outputs: none
+//
+int Delay_MCLK_us(uint32_t val){
+    Delay_cycles(((uint64_t)val * Clock_MCLK_per_us) >> CLOCK_PER_US_SHIFT);
+    return 0;
+} // end Delay_MCLK_us
+
+int Delay_MCLK_ms(uint32_t val){
+    // 1000 * per_us fits 32 bits - 48 << 16 * 1000 < 2^32
+    Delay_cycles(((uint64_t)val * (Clock_MCLK_per_us * 1000UL)) >> CLOCK_PER_US_SHIFT);
+    return 0;
+} // end Delay_MCLK_ms
+
+int Delay_MCLK_sec(uint32_t val){
+    Delay_cycles((uint64_t)val * Clock_MCLK_freq);
+    return 0;
+} // end Delay_MCLK_sec
+
+////////////////////////////////////////////////////////////////////
+//
+// SysTick wait for any number of clocks
+//
+// SysTick counts 2^24 clocks at most - longer waits run back to back
+// reloads of up to 2^24 clocks, each ended by COUNTFLAG
+// Writing VAL restarts the count from LOAD; LOAD + 1 clocks to COUNTFLAG
+// A count of 0 or 1 clock is not a SysTick period (LOAD of 0 never
+// sets COUNTFLAG) - those return at once
+//
+void static Delay_cycles(uint64_t cycles){
+    uint32_t part;
 
-    // Setup the systick timer
     SysTick->CTRL = 0x0005;     // set clk to CPU clk (bit 2) and enable (bit 0)
-    SysTick->LOAD = delay_cnt;
-    SysTick->VAL = 0x0;
+    while(cycles >= 2){
+        part = (cycles > 0x01000000) ? 0x01000000 : (uint32_t)cycles;
+        SysTick->LOAD = part - 1;
+        SysTick->VAL = 0x0;
+        while(!(SysTick->CTRL & 0x00010000))
+            ;
+        cycles -= part;
+    }
+}
 
-    // Wait
-    while(!(SysTick->CTRL & 0x00010000))
-        ;
+////////////////////////////////////////////////////////////////////
 
-    // Done waiting
+////////////////////////////////////////////////////////////////////
+//
+// Low power delays
+//
+////////////////////////////////////////////////////////////////////
+//
+// TIMER_A3 CCR0 ends the wait - the CPU sleeps (WFI) until it fires
+// Waits longer than one 16 bit timer period are chained - the interrupt
+// loads CCR0 with the next part and the CPU goes back to sleep
+//
+#define DELAY_TIMER             TIMER_A3
+#define DELAY_TIMER_IRQn        TA3_0_IRQn
+#define DELAY_TIMER_IRQHandler  TA3_0_IRQHandler
+#define DELAY_TASSEL_ACLK       0x0100
+#define DELAY_TASSEL_SMCLK      0x0200
+#define DELAY_PERIOD_MAX        0x10000UL       // timer counts per interrupt
+
+static volatile uint32_t Delay_left = 0;        // timer counts after the current part
+static volatile uint8_t Delay_done = 1;
+static Delay_stats_t Delay_stats = {0, 0, 0};
+static uint16_t Delay_us_frac = 0;              // LPM0 sleep below 1ms, not yet in sleep_ms
+
+//
+// TIMER_A3 CCR0 interrupt - next part of the wait, or done
+//
+void DELAY_TIMER_IRQHandler(void){
+    uint32_t part;
+    if(Delay_left == 0){
+        DELAY_TIMER->CTL = 0x0000;              // stop
+        DELAY_TIMER->CCTL[0] = 0x0000;          // interrupt off, flag cleared
+        Delay_done = 1;
+        return;
+    }
+    part = (Delay_left > DELAY_PERIOD_MAX) ? DELAY_PERIOD_MAX : Delay_left;
+    Delay_left -= part;
+    DELAY_TIMER->CCR[0] = part - 1;             // timer just rolled to 0 - takes effect now
+    DELAY_TIMER->CCTL[0] &= ~0x0001;            // clear CCIFG
+}
+
+//
+// Sleep for counts of the selected timer clock
+//
+// deep 0 - LPM0 (SLEEPDEEP clear) - clocks keep running, CPU stopped
+// deep 1 - LPM3 (SLEEPDEEP set, PCM LPMR = LPM3) - only ACLK/BCLK run
+//
+// Interrupts are masked around WFI so the timer cannot fire between the
+// check and the sleep - WFI still wakes on the pending interrupt, which is
+// then taken before the next check
+//
+void static Delay_sleep(uint32_t counts, uint16_t tassel, uint8_t deep){
+    uint32_t part;
+    uint32_t int_state;
+
+    if(counts == 0)
+        return;
+    part = (counts > DELAY_PERIOD_MAX) ? DELAY_PERIOD_MAX : counts;
+    Delay_left = counts - part;
+    Delay_done = 0;
+
+    DELAY_TIMER->CTL = 0x0004;                  // stop, clear TAR (TACLR)
+    DELAY_TIMER->EX0 = 0x0000;                  // divide by 1
+    DELAY_TIMER->CCR[0] = part - 1;
+    DELAY_TIMER->CCTL[0] = 0x0010;              // CCIE, compare mode
+    NVIC->ISER[DELAY_TIMER_IRQn >> 5] = 1UL << (DELAY_TIMER_IRQn & 0x1F);
+    DELAY_TIMER->CTL = tassel | 0x0010;         // clock source, up mode
+
+    if(deep){
+        PCM->CTL0 = (PCM->CTL0 & ~0xFFFF00F0) | 0x695A0000;    // key, LPMR = 0000 LPM3
+        SCB->SCR |= 0x0004;                                     // SLEEPDEEP
+    }
+    else{
+        SCB->SCR &= ~0x0004;
+    }
+
+    int_state = _disable_interrupts();
+    while(!Delay_done){
+        __WFI();
+        Delay_stats.wakeups++;
+        __enable_irq();                         // take the interrupt that woke us
+        __disable_irq();
+    }
+    _restore_interrupts(int_state);
+
+    SCB->SCR &= ~0x0004;                        // leave other WFI users in LPM0
+    Delay_stats.sleeps++;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_LPM0_us
+//
+////////////////////////////////////////////////////////////////////
+int Delay_LPM0_us(uint32_t val, uint32_t smclk_freq){
+    uint32_t clks_per_us = smclk_freq / 1000000;
+
+    // input checking
+    // SMCLK at least 1MHz, counts must fit in 32 bits
+    if (clks_per_us == 0 || val > 0xFFFFFFFFUL / clks_per_us){
+        Err_report(ERR_DELAY_LPM0_US, val);
+        return 1;
+    }
+
+    Delay_sleep(val * clks_per_us, DELAY_TASSEL_SMCLK, 0);
+
+    // sleep accounting
+    Delay_stats.sleep_ms += val / 1000;
+    Delay_us_frac += val % 1000;
+    if (Delay_us_frac >= 1000){
+        Delay_us_frac -= 1000;
+        Delay_stats.sleep_ms++;
+    }
     return 0;
-} // end Delay_sec
+} // end Delay_LPM0_us
+
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_LPM3_ms
+//
+////////////////////////////////////////////////////////////////////
+int Delay_LPM3_ms(uint32_t val){
+    uint32_t delay_cnt;
+
+    // input checking
+    // max input is 131,071,999 (2^32 ACLK counts)
+    if (val > 131071999UL){
+        Err_report(ERR_DELAY_LPM3_MS, val);
+        return 1;
+    }
+
+    // 32.768 ACLK counts per ms = 32 + 96/125
+    // split so every step fits in 32 bits - no 64 bit divide
+    delay_cnt = val * 32 + (val / 125) * 96 + ((val % 125) * 96) / 125;
+
+    Delay_sleep(delay_cnt, DELAY_TASSEL_ACLK, 1);
+    Delay_stats.sleep_ms += val;
+    return 0;
+} // end Delay_LPM3_ms
+
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_LPM3_sec
+//
+////////////////////////////////////////////////////////////////////
+int Delay_LPM3_sec(uint32_t val){
+
+    // input checking
+    // max input is 131,071 (2^32 ACLK counts)
+    if (val > 131071UL){
+        Err_report(ERR_DELAY_LPM3_SEC, val);
+        return 1;
+    }
+
+    Delay_sleep(val << 15, DELAY_TASSEL_ACLK, 1);   // 32768 counts per second
+    Delay_stats.sleep_ms += val * 1000;
+    return 0;
+} // end Delay_LPM3_sec
+
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_sleep_stats
+//
+////////////////////////////////////////////////////////////////////
+void Delay_sleep_stats(Delay_stats_t *stats){
+    *stats = Delay_stats;
+}
+void Delay_sleep_stats_clear(void){
+    Delay_stats.sleep_ms = 0;
+    Delay_stats.sleeps = 0;
+    Delay_stats.wakeups = 0;
+    Delay_us_frac = 0;
+}
 
 ////////////////////////////////////////////////////////////////////
 
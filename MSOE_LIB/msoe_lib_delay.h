@@ -8,6 +8,17 @@
  *          Changed the 48MHz delay ms function to use a loop to increase flexibility
  *      Version 1.2 - 7/23/2018
  *          Removed some of the clk cycle added delay to account for small inputs*
+ *      Version 1.3 - 10/17/2026
+ *          Note on sharing SysTick with msoe_lib_timer
+ *      Version 1.4 - 10/17/2026
+ *          Added low power delays (LPM0 / LPM3 with WFI on TIMER_A3)
+ *          and sleep accounting
+ *      Version 1.5 - 10/17/2026
+ *          Added delays that follow the published MCLK (msoe_lib_clk)
+ *          Integer only cycle counts, SysTick reloads chained past 24 bits
+ *      Version 1.6 - 10/17/2026
+ *          Bad input is reported to msoe_lib_err (no delay, returns 1)
+ *          instead of printf / exit - no stdio
  */
 #ifndef __MSOE_LIB_DELAY_H__
 #define __MSOE_LIB_DELAY_H__
@@ -16,10 +27,22 @@
 // Delay Routines
 // us, ms, sec delay functions for 3Mhz and 48Mhz operation
 // us, ms, sec delay function for parameterized frequency operation
+// us, ms, sec delay functions for the current MCLK (follows Clock_48MHz_Divide)
+// low power delays - the CPU sleeps in LPM0 or LPM3 until TIMER_A3 expires
+//
+// The SysTick delays take over SysTick - nothing else runs while they wait
+// Do not use these after Timer_Init (msoe_lib_timer) - the timer wheel owns
+// SysTick, use Timer_wait or Timer_start instead
+//
+// Input outside the maximum (minimum) shown for a routine is reported to
+// msoe_lib_err (ERR_DELAY_xx code and the value), there is no delay and
+// the routine returns 1 - a constant outside the range does not compile
 //
 ////////////////////////////////////////////
 //
 // Includes
+#include <stdint.h>
+#include "msoe_lib_err.h"
 
 //
 ////////////////////////////////////////////////////////////////////
@@ -33,7 +56,8 @@
 // maximum delay ~0.349s
 /////////////////////////////////////
 //
-// This assumes the MSP432 has been programmed to 48MHz
+// This assumes the MSP432 has been programmed to 48MHz by Clock_Init_48MHz
+// The delay follows Clock_48MHz_Divide - see Delay_MCLK_us
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -61,7 +85,8 @@ int Delay_48MHz_us(uint32_t val);
 // maximum delay 65,535 ms
 /////////////////////////////////////
 //
-// This assumes the MSP432 has been programmed to 48MHz
+// This assumes the MSP432 has been programmed to 48MHz by Clock_Init_48MHz
+// The delay follows Clock_48MHz_Divide - see Delay_MCLK_us
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -89,7 +114,8 @@ int Delay_48MHz_ms(uint16_t val);
 // maximum delay 21s
 /////////////////////////////////////
 //
-// This assumes the MSP432 has been programmed to 48MHz
+// This assumes the MSP432 has been programmed to 48MHz by Clock_Init_48MHz
+// The delay follows Clock_48MHz_Divide - see Delay_MCLK_us
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -197,10 +223,11 @@ int Delay_3MHz_sec(uint32_t val);
 ////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////
-// maximum input value = dependent on frequency
+// maximum input value = 2^32 - 1
 /////////////////////////////////////
 //
 // This assumes the MSP432 has been programmed to a known value
+// Delays longer than 2^24 clocks chain SysTick reloads
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -225,10 +252,11 @@ int Delay_us(uint32_t val, uint32_t freq);
 ////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////
-// maximum input value = dependent on frequency
+// maximum input value = 2^32 - 1
 /////////////////////////////////////
 //
 // This assumes the MSP432 has been programmed to a known value
+// Delays longer than 2^24 clocks chain SysTick reloads
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -253,10 +281,11 @@ int Delay_ms(uint32_t val, uint32_t freq);
 ////////////////////////////////////////////////////////////////////
 //
 /////////////////////////////////////
-// maximum input value = dependent on frequency
+// maximum input value = 2^32 - 1
 /////////////////////////////////////
 //
 // This assumes the MSP432 has been programmed to a known value
+// Delays longer than 2^24 clocks chain SysTick reloads
 //
 // Uses the systick timer to create a delay where nothing else happens
 //      No interrupts
@@ -274,5 +303,151 @@ int Delay_ms(uint32_t val, uint32_t freq);
 int Delay_sec(uint32_t val, uint32_t freq);
 ////////////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////////////
+//
+// Delay_MCLK_us / Delay_MCLK_ms / Delay_MCLK_sec
+//
+////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////
+// maximum input value = 2^32 - 1
+/////////////////////////////////////
+//
+// SysTick delays at the current MCLK - the frequency published by
+// Clock_Init_48MHz / Clock_48MHz_Divide (msoe_lib_clk), 3MHz before either
+// Stay correct when the clock is divided at run time
+// Integer only - delays longer than 2^24 clocks chain SysTick reloads
+//
+// Resolution is one MCLK clock, plus the call overhead (~50 clocks)
+//
+// Inputs: delay time in us, ms or sec
+// Outputs: none
+//
+int Delay_MCLK_us(uint32_t val);
+int Delay_MCLK_ms(uint32_t val);
+int Delay_MCLK_sec(uint32_t val);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Low power delays
+//
+////////////////////////////////////////////////////////////////////
+//
+// The CPU sleeps (WFI) until TIMER_A3 ends the wait instead of spinning -
+// other interrupts are still taken (and the CPU sleeps again after them)
+// TIMER_A3 and its CCR0 interrupt (TA3_0_IRQHandler) belong to these delays
+//
+// LPM0 - CPU stopped, all clocks running - SMCLK times the wait
+//        SysTick keeps counting (msoe_lib_timer keeps ticking)
+// LPM3 - only ACLK/BCLK run - ACLK (REFOCLK 32768Hz, set by Clock_Init_48MHz)
+//        times the wait, resolution ~30.5us
+//        MCLK/SMCLK/HSMCLK and SysTick stop - the timer wheel does not tick
+//        and peripherals clocked from them pause
+//        HFXT restarts on wake up
+//
+// Waits longer than one 16 bit timer period wake briefly to load the next
+// part (every 2s for LPM3, every 65536 SMCLK counts for LPM0)
+//
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_LPM0_us
+//
+////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////
+// maximum input value = 2^32 / (smclk_freq / 1MHz)
+//      357,913,941 (~358s) with SMCLK at 12MHz (Clock_Init_48MHz)
+/////////////////////////////////////
+//
+// SMCLK must be a whole number of MHz (1MHz minimum)
+//
+// Inputs: delay time in us
+//          SMCLK frequency
+// Outputs: none
+//
+int Delay_LPM0_us(uint32_t val, uint32_t smclk_freq);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_LPM3_ms
+//
+////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////
+// maximum input value = 131,071,999
+// maximum delay ~36 hours
+/////////////////////////////////////
+//
+// Inputs: delay time in ms
+// Outputs: none
+//
+int Delay_LPM3_ms(uint32_t val);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_LPM3_sec
+//
+////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////
+// maximum input value = 131,071
+// maximum delay ~36 hours
+/////////////////////////////////////
+//
+// Inputs: delay time in sec
+// Outputs: none
+//
+int Delay_LPM3_sec(uint32_t val);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Delay_sleep_stats
+//
+////////////////////////////////////////////////////////////////////
+//
+// Sleep accounting for the low power delays - the active time saved
+//
+// sleep_ms     total time asleep in the low power delays
+// sleeps       low power delays completed
+// wakeups      times the CPU woke during them (timer parts + other interrupts)
+//
+// Duty cycle over a window = 1 - sleep_ms / window length in ms
+// e.g. read the stats, clear them, and compare with Timer_now()
+//
+// Inputs: pointer to the stats to fill in
+// Outputs: none
+//
+typedef struct {
+    uint32_t sleep_ms;
+    uint32_t sleeps;
+    uint32_t wakeups;
+} Delay_stats_t;
+
+void Delay_sleep_stats(Delay_stats_t *stats);
+void Delay_sleep_stats_clear(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Compile time range checks - constant arguments (see ERR_RANGE)
+//
+////////////////////////////////////////////////////////////////////
+#if !defined(__MSOE_LIB_DELAY_C__)
+#define Delay_48MHz_us(val)     Delay_48MHz_us(ERR_RANGE(val, 0, 349524))
+#define Delay_48MHz_ms(val)     Delay_48MHz_ms(ERR_RANGE(val, 0, 65535))
+#define Delay_48MHz_sec(val)    Delay_48MHz_sec(ERR_RANGE(val, 0, 21))
+#define Delay_3MHz_us(val)      Delay_3MHz_us(ERR_RANGE(val, 33, 5529405))
+#define Delay_3MHz_ms(val)      Delay_3MHz_ms(ERR_RANGE(val, 0, 5529))
+#define Delay_3MHz_sec(val)     Delay_3MHz_sec(ERR_RANGE(val, 0, 255))
+#define Delay_LPM3_ms(val)      Delay_LPM3_ms(ERR_RANGE(val, 0, 131071999UL))
+#define Delay_LPM3_sec(val)     Delay_LPM3_sec(ERR_RANGE(val, 0, 131071UL))
+#endif
+////////////////////////////////////////////////////////////////////
+
 #endif // __MSOE_LIB_DELAY_H__
 
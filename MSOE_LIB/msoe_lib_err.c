@@ -0,0 +1,100 @@
+/*
+ * msoe_lib_err.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     error ring with an optional hook, compile time range checks
+ *
+ */
+#ifndef __MSOE_LIB_ERR_C__
+#define __MSOE_LIB_ERR_C__
+////////////////////////////////////////////
+//
+// Error Reporting Routines - see msoe_lib_err.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msp432.h"
+#include "msoe_lib_err.h"
+
+#if (ERR_RING & (ERR_RING - 1)) != 0 || ERR_RING > 128
+#error "ERR_RING must be a power of 2, 128 or less"
+#endif
+
+//
+// Free running head / tail - the ring index is the low bits
+//
+static Err_t Err_ring[ERR_RING];
+static volatile uint8_t Err_head = 0;           // next report written
+static volatile uint8_t Err_tail = 0;           // next report read
+static volatile uint32_t Err_dropped = 0;
+static void (*volatile Err_hook)(uint16_t code, uint32_t arg) = 0;
+
+////////////////////////////////////////////////////////////////////
+//
+// Err_report
+//
+////////////////////////////////////////////////////////////////////
+void Err_report(uint16_t code, uint32_t arg){
+    uint32_t int_state = _disable_interrupts();
+    void (*hook)(uint16_t code, uint32_t arg);
+
+    if((uint8_t)(Err_head - Err_tail) >= ERR_RING){     // full - drop the oldest
+        Err_tail++;
+        Err_dropped++;
+    }
+    Err_ring[Err_head & (ERR_RING - 1)].code = code;
+    Err_ring[Err_head & (ERR_RING - 1)].arg = arg;
+    Err_head++;
+    hook = Err_hook;
+    _restore_interrupts(int_state);
+
+    if(hook)
+        hook(code, arg);
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Err_get / Err_pending / Err_lost
+//
+////////////////////////////////////////////////////////////////////
+uint8_t Err_get(Err_t *err){
+    uint32_t int_state = _disable_interrupts();
+
+    if(Err_head == Err_tail){
+        _restore_interrupts(int_state);
+        return 0;
+    }
+    *err = Err_ring[Err_tail & (ERR_RING - 1)];
+    Err_tail++;
+    _restore_interrupts(int_state);
+    return 1;
+}
+
+uint8_t Err_pending(void){
+    return (uint8_t)(Err_head - Err_tail);
+}
+
+uint32_t Err_lost(void){
+    return Err_dropped;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Err_set_hook / Err_clear
+//
+////////////////////////////////////////////////////////////////////
+void Err_set_hook(void (*hook)(uint16_t code, uint32_t arg)){
+    Err_hook = hook;
+}
+
+void Err_clear(void){
+    uint32_t int_state = _disable_interrupts();
+    Err_tail = Err_head;
+    Err_dropped = 0;
+    _restore_interrupts(int_state);
+}
+
+#endif // __MSOE_LIB_ERR_C__
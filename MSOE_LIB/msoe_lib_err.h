@@ -0,0 +1,128 @@
+/*
+ * msoe_lib_err.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     error ring with an optional hook, compile time range checks
+ *
+ */
+#ifndef __MSOE_LIB_ERR_H__
+#define __MSOE_LIB_ERR_H__
+////////////////////////////////////////////
+//
+// Error Reporting Routines
+//
+// Library routines report bad input here instead of printing and halting
+// Each report (code + the offending value) goes in a small ring the main
+// loop can read at its leisure, and to an optional hook (e.g. set a flag,
+// light an LED, or stop in the debugger)
+// When the ring is full the oldest report is dropped and counted
+//
+// Reporting is safe from interrupts and costs no stdio
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Reports kept (power of 2)
+//
+#if !defined(ERR_RING)
+#define ERR_RING            8
+#endif
+
+//
+// Error codes - module in the high byte
+//
+#define ERR_NONE                0x0000
+
+#define ERR_DELAY_48MHZ_US      0x0101      // msoe_lib_delay
+#define ERR_DELAY_48MHZ_SEC     0x0102
+#define ERR_DELAY_3MHZ_US       0x0103
+#define ERR_DELAY_3MHZ_MS       0x0104
+#define ERR_DELAY_3MHZ_SEC      0x0105
+#define ERR_DELAY_LPM0_US       0x0106
+#define ERR_DELAY_LPM3_MS       0x0107
+#define ERR_DELAY_LPM3_SEC      0x0108
+
+typedef struct {
+    uint16_t code;
+    uint32_t arg;                   // offending value
+} Err_t;
+
+////////////////////////////////////////////////////////////////////
+//
+// ERR_RANGE
+//
+////////////////////////////////////////////////////////////////////
+//
+// Compile time range check of an argument - a constant outside lo..hi
+// does not compile (negative array size), anything else passes through
+// unchanged and is checked at run time by the routine
+// One unsigned compare - val - lo wraps above hi - lo when val < lo
+//      e.g. Delay_48MHz_ms(70000) is a compile error
+//
+// Needs the GCC builtins (gcc, and the TI compiler with GCC extensions) -
+// otherwise only the run time check is done
+//
+#if defined(__GNUC__)
+#define ERR_RANGE(val, lo, hi)                                              \
+    __builtin_choose_expr(__builtin_constant_p(val),                        \
+        ((void)sizeof(char[((uint32_t)((val) - (lo)) <= (uint32_t)((hi) - (lo))) ? 1 : -1]), (val)), \
+        (val))
+#else
+#define ERR_RANGE(val, lo, hi)  (val)
+#endif
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Err_report
+//
+////////////////////////////////////////////////////////////////////
+//
+// Puts a report in the ring and calls the hook (from the caller's
+// context - keep the hook short, it may run in an interrupt)
+//
+// Inputs: error code, offending value
+// Outputs: none
+//
+void Err_report(uint16_t code, uint32_t arg);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Err_get / Err_pending / Err_lost
+//
+////////////////////////////////////////////////////////////////////
+//
+// Err_get takes the oldest report out of the ring
+// Err_pending is the number of reports in the ring
+// Err_lost is the number of reports dropped because the ring was full
+//
+// Inputs: pointer to the report to fill in
+// Outputs: 1 if a report was taken, 0 if the ring was empty
+//
+uint8_t Err_get(Err_t *err);
+uint8_t Err_pending(void);
+uint32_t Err_lost(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Err_set_hook / Err_clear
+//
+////////////////////////////////////////////////////////////////////
+//
+// Err_set_hook - routine called for every report, 0 for none
+// Err_clear - empties the ring and the lost count
+//
+// Inputs: hook
+// Outputs: none
+//
+void Err_set_hook(void (*hook)(uint16_t code, uint32_t arg));
+void Err_clear(void);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_ERR_H__
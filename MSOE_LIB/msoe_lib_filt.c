@@ -0,0 +1,138 @@
+/*
+ * msoe_lib_filt.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     median, moving average and exponential filters
+ *
+ */
+#ifndef __MSOE_LIB_FILT_C__
+#define __MSOE_LIB_FILT_C__
+////////////////////////////////////////////
+//
+// Sample Filter Routines - see msoe_lib_filt.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msoe_lib_filt.h"
+
+#define FILT_SORT(a, b)     if((a) > (b)){ t = (a); (a) = (b); (b) = t; }
+
+//
+// Local routines
+//
+uint32_t static Filt_median(const uint32_t *m);
+void static Filt_fill(Filt_t *f, uint32_t x);
+
+////////////////////////////////////////////////////////////////////
+//
+// Filt_Init
+//
+////////////////////////////////////////////////////////////////////
+int Filt_Init(Filt_t *f, const Filt_cfg_t *cfg){
+    uint8_t shift = 0;
+
+    if((cfg->mode & FILT_AVG) && (cfg->mode & FILT_EMA))
+        return 1;
+    if(cfg->mode & FILT_AVG){
+        if(cfg->avg_len == 0 || cfg->avg_len > FILT_AVG_MAX || (cfg->avg_len & (cfg->avg_len - 1)))
+            return 1;
+        while((1U << shift) < cfg->avg_len)
+            shift++;
+    }
+    if((cfg->mode & FILT_EMA) && (cfg->ema_shift == 0 || cfg->ema_shift > FILT_EMA_SHIFT_MAX))
+        return 1;
+
+    f->cfg = *cfg;
+    f->avg_shift = shift;
+    Filt_reset(f);
+    return 0;
+}
+
+void Filt_reset(Filt_t *f){
+    f->n = 0;
+    f->out = 0;
+    f->med_i = 0;
+    f->avg_i = 0;
+    f->sum = 0;
+}
+
+//
+// First sample - the whole history is that sample
+//
+void static Filt_fill(Filt_t *f, uint32_t x){
+    uint8_t i;
+
+    for(i = 0; i < FILT_MEDIAN_LEN; i++)
+        f->med[i] = x;
+    for(i = 0; i < f->cfg.avg_len && i < FILT_AVG_MAX; i++)
+        f->avg[i] = x;
+    if(f->cfg.mode & FILT_AVG)
+        f->sum = (uint64_t)x << f->avg_shift;
+    else if(f->cfg.mode & FILT_EMA)
+        f->sum = (uint64_t)x << f->cfg.ema_shift;
+}
+
+//
+// Median of 5 - 7 compare and swaps on a copy (the history stays in
+// arrival order)
+//
+uint32_t static Filt_median(const uint32_t *m){
+    uint32_t a = m[0], b = m[1], c = m[2], d = m[3], e = m[4];
+    uint32_t t;
+
+    FILT_SORT(a, b);
+    FILT_SORT(d, e);
+    FILT_SORT(a, d);
+    FILT_SORT(b, e);
+    FILT_SORT(b, c);
+    FILT_SORT(c, d);
+    FILT_SORT(b, c);
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Filt_add
+//
+////////////////////////////////////////////////////////////////////
+//
+// Average - the oldest sample leaves the sum as the new one comes in
+// EMA - sum holds the output with ema_shift more bits,
+//      sum = sum - sum / 2^shift + x
+// The dropped fractions keep sum up to 2^shift over the exact value - the
+// output (truncated, not rounded) is within 1 of the exact average
+//
+uint32_t Filt_add(Filt_t *f, uint32_t x){
+    uint8_t mode = f->cfg.mode;
+
+    if(f->n++ == 0)
+        Filt_fill(f, x);
+
+    if(mode & FILT_MEDIAN){
+        f->med[f->med_i] = x;
+        if(++f->med_i == FILT_MEDIAN_LEN)
+            f->med_i = 0;
+        x = Filt_median(f->med);
+    }
+
+    if(mode & FILT_AVG){
+        f->sum += x;
+        f->sum -= f->avg[f->avg_i];
+        f->avg[f->avg_i] = x;
+        f->avg_i = (f->avg_i + 1) & (f->cfg.avg_len - 1);
+        x = (uint32_t)((f->sum + ((1U << f->avg_shift) >> 1)) >> f->avg_shift);
+    }
+    else if(mode & FILT_EMA){
+        f->sum -= f->sum >> f->cfg.ema_shift;
+        f->sum += x;
+        x = (uint32_t)(f->sum >> f->cfg.ema_shift);
+    }
+
+    f->out = x;
+    return x;
+}
+
+#endif // __MSOE_LIB_FILT_C__
@@ -0,0 +1,113 @@
+/*
+ * msoe_lib_filt.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     median, moving average and exponential filters
+ *
+ */
+#ifndef __MSOE_LIB_FILT_H__
+#define __MSOE_LIB_FILT_H__
+////////////////////////////////////////////
+//
+// Sample Filter Routines
+//
+// Smooths a stream of samples (e.g. msoe_lib_cap revolution periods) so one
+// bad edge does not make the reading jump. Up to two stages, chosen by the
+// mode bits
+//      FILT_MEDIAN - median of the last 5 samples - a single glitch (a
+//                    period split by a reflection, or doubled by a missed
+//                    pulse) never gets through, two in a row do not either
+//      FILT_AVG    - mean of the last avg_len samples (ring buffer and
+//                    running sum)
+//      FILT_EMA    - exponential average, each sample moves the output
+//                    1/2^ema_shift of the way to it
+// The median runs first, then the average or the EMA (not both)
+//
+// Every stage is O(1) per sample in integer math - no divides (the average
+// length is a power of 2), 64 bit adds and shifts only. The first sample
+// after Filt_Init or Filt_reset fills all of the history, so the output
+// starts at the first sample rather than ramping up from 0
+//
+//      Filt_t spd;
+//      Filt_cfg_t cfg = {FILT_MEDIAN | FILT_AVG, 4, 0};
+//
+//      Filt_Init(&spd, &cfg);
+//      each period:    Filt_add(&spd, period);
+//      display:        Speed_tenths(spd.out);
+//
+// Not interrupt safe - add and read from the same task (or mask)
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Mode bits
+//
+#define FILT_MEDIAN         0x01
+#define FILT_AVG            0x02
+#define FILT_EMA            0x04
+
+//
+// Longest moving average
+//
+#if !defined(FILT_AVG_MAX)
+#define FILT_AVG_MAX        16
+#endif
+
+#define FILT_MEDIAN_LEN     5
+#define FILT_EMA_SHIFT_MAX  8
+
+typedef struct {
+    uint8_t mode;                   // FILT_ bits
+    uint8_t avg_len;                // FILT_AVG samples (1 to FILT_AVG_MAX, power of 2)
+    uint8_t ema_shift;              // FILT_EMA weight 1/2^shift (1 to FILT_EMA_SHIFT_MAX)
+} Filt_cfg_t;
+
+typedef struct {
+    Filt_cfg_t cfg;
+    uint8_t avg_shift;              // log2 avg_len
+    uint8_t med_i;                  // next median slot
+    uint8_t avg_i;                  // next average slot
+    uint32_t n;                     // samples since the reset
+    uint32_t out;                   // filtered value - 0 until the first sample
+    uint32_t med[FILT_MEDIAN_LEN];
+    uint32_t avg[FILT_AVG_MAX];
+    uint64_t sum;                   // FILT_AVG - sum of avg[0 .. avg_len-1]
+                                    // FILT_EMA - output x 2^ema_shift
+} Filt_t;
+
+////////////////////////////////////////////////////////////////////
+//
+// Filt_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Inputs: filter, settings (copied)
+// Outputs: 0 for success
+//          1 bad settings - both FILT_AVG and FILT_EMA, a length that is
+//            not a power of 2 or too long, a shift out of range
+//
+int Filt_Init(Filt_t *f, const Filt_cfg_t *cfg);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Filt_add / Filt_reset
+//
+////////////////////////////////////////////////////////////////////
+//
+// Filt_add - one sample in, the new output (also in f->out)
+// Filt_reset - forgets the history (e.g. the wheel stopped) - the output
+// is 0 until the next sample
+//
+// Inputs: filter, sample / filter
+// Outputs: filtered value / none
+//
+uint32_t Filt_add(Filt_t *f, uint32_t x);
+void Filt_reset(Filt_t *f);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_FILT_H__
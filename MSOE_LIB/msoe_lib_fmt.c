@@ -0,0 +1,411 @@
+/*
+ * msoe_lib_fmt.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     integer to decimal text formatter
+ *      Rev:    0.2     float formatter - scientific and fixed point
+ *
+ */
+#ifndef __MSOE_LIB_FMT_C__
+#define __MSOE_LIB_FMT_C__
+////////////////////////////////////////////
+//
+// Number formatting - see msoe_lib_fmt.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msoe_lib_fmt.h"
+
+//
+// Powers of ten times 8, 4, 2, 1 - index is the digit position
+// 8 x 10^9 does not fit in 32 bits (and the top digit of a 32 bit value is
+// at most 4) so it is 0 and skipped
+//
+static const uint32_t Fmt_pow10[10][4] = {
+    {8UL,          4UL,          2UL,          1UL},
+    {80UL,         40UL,         20UL,         10UL},
+    {800UL,        400UL,        200UL,        100UL},
+    {8000UL,       4000UL,       2000UL,       1000UL},
+    {80000UL,      40000UL,      20000UL,      10000UL},
+    {800000UL,     400000UL,     200000UL,     100000UL},
+    {8000000UL,    4000000UL,    2000000UL,    1000000UL},
+    {80000000UL,   40000000UL,   20000000UL,   10000000UL},
+    {800000000UL,  400000000UL,  200000000UL,  100000000UL},
+    {0UL,          4000000000UL, 2000000000UL, 1000000000UL}
+};
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_udec
+//
+////////////////////////////////////////////////////////////////////
+//
+// Each digit (most significant first) is built one bit at a time -
+// compare against 8, 4, 2 and 1 times the power of ten and subtract
+// Always 4 compares per digit, no divide or multiply
+//
+uint8_t Fmt_udec(char *buf, uint32_t val, uint8_t width){
+    int8_t i;
+    uint8_t n = 0;
+    uint8_t lead = 1;                       // still in the leading zeros
+    char digit;
+    const uint32_t *pow;
+
+    for(i = width - 1; i >= 0; i--){
+        pow = Fmt_pow10[i];
+        digit = '0';
+        if(pow[0] != 0 && val >= pow[0]){   // 8
+            val -= pow[0];
+            digit += 8;
+        }
+        if(val >= pow[1]){                  // 4
+            val -= pow[1];
+            digit += 4;
+        }
+        if(val >= pow[2]){                  // 2
+            val -= pow[2];
+            digit += 2;
+        }
+        if(val >= pow[3]){                  // 1
+            val -= pow[3];
+            digit += 1;
+        }
+        if(digit != '0' || i == 0)          // first non zero digit, or the ones digit
+            lead = 0;
+        buf[n++] = lead ? ' ' : digit;
+    }
+    buf[n] = 0;
+    return n;
+}
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_dec
+//
+////////////////////////////////////////////////////////////////////
+uint8_t Fmt_dec(char *buf, int32_t val, uint8_t width){
+    if(val < 0){
+        buf[0] = '-';
+        return 1 + Fmt_udec(buf + 1, 0UL - (uint32_t)val, width);
+    }
+    return Fmt_udec(buf, (uint32_t)val, width);
+}
+////////////////////////////////////////////////////////////////////
+
+//
+// Powers of ten for the float formatter - 10^k = m * 2^e with m normalized
+// (top bit set), rounded to nearest
+// k = FMT_P10_MIN to FMT_P10_MAX covers every float scaled to 5 digits
+// 10^0 to 10^27 are exact
+//
+#define FMT_P10_MIN     (-34)
+#define FMT_P10_MAX     49
+#define FMT_P10_EXACT   27
+
+typedef struct {
+    uint64_t m;
+    int16_t e;
+} Fmt_p10_t;
+
+static const Fmt_p10_t Fmt_p10[FMT_P10_MAX - FMT_P10_MIN + 1] = {
+    {0x84EC3C97DA624AB5ULL, -176},   // 1e-34
+    {0xA6274BBDD0FADD62ULL, -173},   // 1e-33
+    {0xCFB11EAD453994BAULL, -170},   // 1e-32
+    {0x81CEB32C4B43FCF5ULL, -166},   // 1e-31
+    {0xA2425FF75E14FC32ULL, -163},   // 1e-30
+    {0xCAD2F7F5359A3B3EULL, -160},   // 1e-29
+    {0xFD87B5F28300CA0EULL, -157},   // 1e-28
+    {0x9E74D1B791E07E48ULL, -153},   // 1e-27
+    {0xC612062576589DDBULL, -150},   // 1e-26
+    {0xF79687AED3EEC551ULL, -147},   // 1e-25
+    {0x9ABE14CD44753B53ULL, -143},   // 1e-24
+    {0xC16D9A0095928A27ULL, -140},   // 1e-23
+    {0xF1C90080BAF72CB1ULL, -137},   // 1e-22
+    {0x971DA05074DA7BEFULL, -133},   // 1e-21
+    {0xBCE5086492111AEBULL, -130},   // 1e-20
+    {0xEC1E4A7DB69561A5ULL, -127},   // 1e-19
+    {0x9392EE8E921D5D07ULL, -123},   // 1e-18
+    {0xB877AA3236A4B449ULL, -120},   // 1e-17
+    {0xE69594BEC44DE15BULL, -117},   // 1e-16
+    {0x901D7CF73AB0ACD9ULL, -113},   // 1e-15
+    {0xB424DC35095CD80FULL, -110},   // 1e-14
+    {0xE12E13424BB40E13ULL, -107},   // 1e-13
+    {0x8CBCCC096F5088CCULL, -103},   // 1e-12
+    {0xAFEBFF0BCB24AAFFULL, -100},   // 1e-11
+    {0xDBE6FECEBDEDD5BFULL,  -97},   // 1e-10
+    {0x89705F4136B4A597ULL,  -93},   // 1e-9
+    {0xABCC77118461CEFDULL,  -90},   // 1e-8
+    {0xD6BF94D5E57A42BCULL,  -87},   // 1e-7
+    {0x8637BD05AF6C69B6ULL,  -83},   // 1e-6
+    {0xA7C5AC471B478423ULL,  -80},   // 1e-5
+    {0xD1B71758E219652CULL,  -77},   // 1e-4
+    {0x83126E978D4FDF3BULL,  -73},   // 1e-3
+    {0xA3D70A3D70A3D70AULL,  -70},   // 1e-2
+    {0xCCCCCCCCCCCCCCCDULL,  -67},   // 1e-1
+    {0x8000000000000000ULL,  -63},   // 1e0 exact
+    {0xA000000000000000ULL,  -60},   // 1e1 exact
+    {0xC800000000000000ULL,  -57},   // 1e2 exact
+    {0xFA00000000000000ULL,  -54},   // 1e3 exact
+    {0x9C40000000000000ULL,  -50},   // 1e4 exact
+    {0xC350000000000000ULL,  -47},   // 1e5 exact
+    {0xF424000000000000ULL,  -44},   // 1e6 exact
+    {0x9896800000000000ULL,  -40},   // 1e7 exact
+    {0xBEBC200000000000ULL,  -37},   // 1e8 exact
+    {0xEE6B280000000000ULL,  -34},   // 1e9 exact
+    {0x9502F90000000000ULL,  -30},   // 1e10 exact
+    {0xBA43B74000000000ULL,  -27},   // 1e11 exact
+    {0xE8D4A51000000000ULL,  -24},   // 1e12 exact
+    {0x9184E72A00000000ULL,  -20},   // 1e13 exact
+    {0xB5E620F480000000ULL,  -17},   // 1e14 exact
+    {0xE35FA931A0000000ULL,  -14},   // 1e15 exact
+    {0x8E1BC9BF04000000ULL,  -10},   // 1e16 exact
+    {0xB1A2BC2EC5000000ULL,   -7},   // 1e17 exact
+    {0xDE0B6B3A76400000ULL,   -4},   // 1e18 exact
+    {0x8AC7230489E80000ULL,    0},   // 1e19 exact
+    {0xAD78EBC5AC620000ULL,    3},   // 1e20 exact
+    {0xD8D726B7177A8000ULL,    6},   // 1e21 exact
+    {0x878678326EAC9000ULL,   10},   // 1e22 exact
+    {0xA968163F0A57B400ULL,   13},   // 1e23 exact
+    {0xD3C21BCECCEDA100ULL,   16},   // 1e24 exact
+    {0x84595161401484A0ULL,   20},   // 1e25 exact
+    {0xA56FA5B99019A5C8ULL,   23},   // 1e26 exact
+    {0xCECB8F27F4200F3AULL,   26},   // 1e27 exact
+    {0x813F3978F8940984ULL,   30},   // 1e28
+    {0xA18F07D736B90BE5ULL,   33},   // 1e29
+    {0xC9F2C9CD04674EDFULL,   36},   // 1e30
+    {0xFC6F7C4045812296ULL,   39},   // 1e31
+    {0x9DC5ADA82B70B59EULL,   43},   // 1e32
+    {0xC5371912364CE305ULL,   46},   // 1e33
+    {0xF684DF56C3E01BC7ULL,   49},   // 1e34
+    {0x9A130B963A6C115CULL,   53},   // 1e35
+    {0xC097CE7BC90715B3ULL,   56},   // 1e36
+    {0xF0BDC21ABB48DB20ULL,   59},   // 1e37
+    {0x96769950B50D88F4ULL,   63},   // 1e38
+    {0xBC143FA4E250EB31ULL,   66},   // 1e39
+    {0xEB194F8E1AE525FDULL,   69},   // 1e40
+    {0x92EFD1B8D0CF37BEULL,   73},   // 1e41
+    {0xB7ABC627050305AEULL,   76},   // 1e42
+    {0xE596B7B0C643C719ULL,   79},   // 1e43
+    {0x8F7E32CE7BEA5C70ULL,   83},   // 1e44
+    {0xB35DBF821AE4F38CULL,   86},   // 1e45
+    {0xE0352F62A19E306FULL,   89},   // 1e46
+    {0x8C213D9DA502DE45ULL,   93},   // 1e47
+    {0xAF298D050E4395D7ULL,   96},   // 1e48
+    {0xDAF3F04651D47B4CULL,   99}    // 1e49
+};
+
+#define FMT_OVF     0xFFFFFFFFUL        // Fmt_scale result does not fit
+
+//
+// Fmt_scale
+//
+// m * 2^e2 * 10^k rounded to the nearest integer (ties to even, like printf)
+//
+// The 24 bit mantissa times the 64 bit power of ten is an 88 bit fixed point
+// product - the top 64 bits are kept, the rest only matters for ties
+// An exact tie with an inexact power of ten (k < 0) only happens for integer
+// values, so those are checked against the exact remainder
+//
+static uint32_t Fmt_scale(uint32_t m, int16_t e2, int8_t k){
+    const Fmt_p10_t *p = &Fmt_p10[k - FMT_P10_MIN];
+    uint64_t lo = (uint64_t)m * (uint32_t)p->m;
+    uint64_t hi = (uint64_t)m * (uint32_t)(p->m >> 32) + (lo >> 32);
+    int16_t shift = -(e2 + p->e + 32);  // fraction bits in hi
+    uint8_t sticky;                     // non zero bits below hi
+    uint64_t q;
+    uint64_t r;
+    uint64_t half;
+    uint64_t v;
+    uint32_t d;
+
+    if(shift >= 64)                     // below 2^-8 - rounds to 0
+        return 0;
+    if(shift <= 0 || (hi >> shift) >= FMT_OVF)
+        return FMT_OVF;
+
+    q = hi >> shift;
+    while(e2 < 0 && (m & 1) == 0){      // drop trailing zero bits - integer values get e2 >= 0
+        m >>= 1;
+        e2++;
+    }
+    if(k < 0 && k >= -9 && e2 >= 0 && e2 <= 39){    // integer value - exact remainder
+        v = (uint64_t)m << e2;
+        d = Fmt_pow10[-k][3];
+        while(q * d > v)
+            q--;
+        r = v - q * d;
+        while(r >= d){
+            r -= d;
+            q++;
+        }
+        if(2 * r > d || (2 * r == d && (q & 1)))
+            q++;
+        return (q >= FMT_OVF) ? FMT_OVF : (uint32_t)q;
+    }
+
+    sticky = ((uint32_t)lo != 0) || (k < 0) || (k > FMT_P10_EXACT);
+    r = hi & (((uint64_t)1 << shift) - 1);
+    half = (uint64_t)1 << (shift - 1);
+    if(r > half || (r == half && (sticky || (q & 1))))
+        q++;
+    return (q >= FMT_OVF) ? FMT_OVF : (uint32_t)q;
+}
+
+//
+// Fmt_unpack
+//
+// Split a float into sign, mantissa and power of 2 - val = m * 2^e2
+// Returns the IEEE biased exponent (0xFF for INF / NAN)
+//
+static int16_t Fmt_unpack(float val, uint8_t *neg, uint32_t *m, int16_t *e2){
+    union {
+        float f;
+        uint32_t u;
+    } bits;
+    int16_t be;
+
+    bits.f = val;
+    *neg = (bits.u >> 31) != 0;
+    *m = bits.u & 0x007FFFFFUL;
+    be = (bits.u >> 23) & 0xFF;
+    if(be == 0)
+        *e2 = -149;                     // zero or denormal - no hidden bit
+    else{
+        *m |= 0x00800000UL;             // hidden bit
+        *e2 = be - 150;
+    }
+    return be;
+}
+
+//
+// Copy a fixed string, return its length
+//
+static uint8_t Fmt_copy(char *buf, const char *str){
+    uint8_t n = 0;
+    while(str[n] != 0){
+        buf[n] = str[n];
+        n++;
+    }
+    buf[n] = 0;
+    return n;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_float_sci
+//
+////////////////////////////////////////////////////////////////////
+//
+// The decimal exponent comes from the binary exponent -
+// log10(2) ~ 1233 / 4096 - and is corrected by at most one step when the
+// scaled value is not 5 digits
+//
+uint8_t Fmt_float_sci(char *buf, float val){
+    uint8_t neg;
+    uint32_t m;
+    int16_t e2;
+    int16_t e10;
+    int16_t log2;
+    uint32_t q;
+    uint8_t n = 0;
+    uint8_t tens;
+    char digits[FMT_DEC_BUF];
+
+    if(Fmt_unpack(val, &neg, &m, &e2) == 0xFF)
+        return Fmt_copy(buf, (m & 0x007FFFFFUL) ? "NAN" : (neg ? "-INF" : "INF"));
+    if(neg)
+        buf[n++] = '-';
+    if(m == 0)
+        return n + Fmt_copy(buf + n, "0.0000E0");
+
+    log2 = e2 + 23;                     // floor(log2(val)) for normal values
+    for(q = m; q < 0x00800000UL; q <<= 1)
+        log2--;                         // denormals
+    e10 = (log2 * 1233) >> 12;          // arithmetic shift - floor
+
+    for(;;){                            // scale to 5 digits - xxxxx
+        q = Fmt_scale(m, e2, 4 - e10);
+        if(q < 10000)
+            e10--;
+        else if(q >= 100000)            // includes 99999.5 rounding up to 100000
+            e10++;
+        else
+            break;
+    }
+
+    Fmt_udec(digits, q, 5);
+    buf[n++] = digits[0];               // x.xxxx
+    buf[n++] = '.';
+    buf[n++] = digits[1];
+    buf[n++] = digits[2];
+    buf[n++] = digits[3];
+    buf[n++] = digits[4];
+    buf[n++] = 'E';
+    if(e10 < 0){
+        buf[n++] = '-';
+        e10 = -e10;
+    }
+    for(tens = 0; e10 >= 10; tens++)    // exponent - no leading zero
+        e10 -= 10;
+    if(tens)
+        buf[n++] = '0' + tens;
+    buf[n++] = '0' + e10;
+    buf[n] = 0;
+    return n;
+}
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_float_fix
+//
+////////////////////////////////////////////////////////////////////
+//
+// The value times 10^frac is rounded to an integer and formatted by Fmt_udec,
+// then the decimal point is inserted
+//
+uint8_t Fmt_float_fix(char *buf, float val, uint8_t int_width, uint8_t frac){
+    uint8_t neg;
+    uint32_t m;
+    int16_t e2;
+    uint32_t q;
+    uint8_t n = 0;
+    uint8_t width = int_width + frac;
+    uint8_t i;
+
+    if(Fmt_unpack(val, &neg, &m, &e2) == 0xFF)
+        q = FMT_OVF;
+    else
+        q = Fmt_scale(m, e2, frac);
+    if(q != FMT_OVF && width < 10 && q >= Fmt_pow10[width][3])
+        q = FMT_OVF;
+    if(q == FMT_OVF){                   // does not fit - fill with '*'
+        for(i = 0; i < width + (frac != 0); i++)
+            buf[i] = '*';
+        buf[i] = 0;
+        return i;
+    }
+
+    if(neg && q != 0)                   // no "-0.0"
+        buf[n++] = '-';
+    Fmt_udec(buf + n, q, width);
+    for(i = 0; i < frac + 1; i++)       // digits from the ones place on are shown
+        if(buf[n + width - 1 - i] == ' ')
+            buf[n + width - 1 - i] = '0';
+    if(frac){
+        for(i = 0; i < frac; i++)       // open a gap for the decimal point
+            buf[n + width - i] = buf[n + width - 1 - i];
+        buf[n + int_width] = '.';
+        width++;
+    }
+    n += width;
+    buf[n] = 0;
+    return n;
+}
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_FMT_C__
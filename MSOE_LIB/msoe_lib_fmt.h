@@ -0,0 +1,108 @@
+/*
+ * msoe_lib_fmt.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     integer to decimal text formatter
+ *      Rev:    0.2     float formatter - scientific and fixed point
+ *
+ */
+#ifndef __MSOE_LIB_FMT_H__
+#define __MSOE_LIB_FMT_H__
+////////////////////////////////////////////
+//
+// Number formatting
+//
+// Shared by the LCD print routines (and anything else that displays numbers)
+// Text is written to a caller buffer so it can be sent in one go - e.g.
+//      char buf[FMT_DEC_BUF];
+//      Fmt_udec(buf, speed, 3);
+//      LCD_print_str(buf);
+//
+// Digits come from a power of ten table by compare and subtract -
+// no divide, no multiply, 4 compares per digit
+// Floats are formatted from the IEEE bits with integer math only
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Largest buffer needed - sign + 10 digits + terminating 0
+// also fits any Fmt_float_sci / Fmt_float_fix result
+//
+#define FMT_DEC_BUF     12
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_udec
+//
+////////////////////////////////////////////////////////////////////
+//
+// Unsigned decimal, right aligned in width digits (1 to 10)
+// Leading zeros are printed as spaces, 0 prints as a single '0'
+// The value must fit in width digits
+//
+// Inputs: buffer (at least width + 1 chars), value, width
+// Outputs: number of characters written (not counting the terminating 0)
+//
+uint8_t Fmt_udec(char *buf, uint32_t val, uint8_t width);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_dec
+//
+////////////////////////////////////////////////////////////////////
+//
+// Signed decimal - negative values get a leading '-' followed by width digits
+// formatted as Fmt_udec, positive values are the same as Fmt_udec
+// INT32_MIN is handled (magnitude taken as unsigned)
+//
+// Inputs: buffer (at least width + 2 chars), value, width
+// Outputs: number of characters written (not counting the terminating 0)
+//
+uint8_t Fmt_dec(char *buf, int32_t val, uint8_t width);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_float_sci
+//
+////////////////////////////////////////////////////////////////////
+//
+// Float in scientific notation - x.xxxxExx, 5 significant digits
+// e.g. 1.2346E5, -3.0000E-12, 0.0000E0, INF, NAN
+// Rounded to nearest (ties to even) - the same digits as printf("%.4e")
+//
+// The decimal exponent is taken from the IEEE exponent bits and the
+// mantissa is scaled with a 64 bit fixed point power of ten - no float math
+//
+// Inputs: buffer (FMT_DEC_BUF chars), value
+// Outputs: number of characters written (not counting the terminating 0)
+//
+uint8_t Fmt_float_sci(char *buf, float val);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Fmt_float_fix
+//
+////////////////////////////////////////////////////////////////////
+//
+// Float in fixed point - int_width digits, '.', frac digits
+// e.g. Fmt_float_fix(buf, 7.96, 2, 1) -> " 8.0"
+// Leading zeros are spaces, the ones digit is always shown, no '.' when frac is 0
+// Negative values get a leading '-' (not when they round to 0)
+// Values that do not fit (and INF / NAN) print as '*' over the whole field
+// Rounded to nearest (ties to even) like printf("%.*f")
+//
+// Inputs: buffer (FMT_DEC_BUF chars), value, int_width (1 or more),
+//         frac (0 or more) - int_width + frac is at most 9
+// Outputs: number of characters written (not counting the terminating 0)
+//
+uint8_t Fmt_float_fix(char *buf, float val, uint8_t int_width, uint8_t frac);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_FMT_H__
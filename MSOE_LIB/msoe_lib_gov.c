@@ -0,0 +1,193 @@
+/*
+ * msoe_lib_gov.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     load driven clock divider governor
+ *
+ */
+#ifndef __MSOE_LIB_GOV_C__
+#define __MSOE_LIB_GOV_C__
+////////////////////////////////////////////
+//
+// Clock Governor Routines - see msoe_lib_gov.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msoe_lib_gov.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_sched.h"
+#include "msoe_lib_time.h"
+
+volatile uint8_t Gov_divider = 1;
+volatile uint32_t Gov_changes = 0;
+volatile uint32_t Gov_refused = 0;
+
+static Gov_cfg_t Gov_cfg = {GOV_UP, GOV_DOWN, GOV_HOLD, GOV_SLOWEST, GOV_PERIOD_US};
+static uint8_t Gov_quiet = 0;               // periods in a row below down
+static uint8_t Gov_started = 0;             // Gov_poll has a start point
+static uint32_t Gov_last_us;
+static uint32_t Gov_last_sleep;
+
+//
+// Local routines
+//
+uint8_t static Gov_vcore(uint8_t divider);
+uint8_t static Gov_wait(uint8_t divider);
+
+////////////////////////////////////////////////////////////////////
+//
+// Operating points
+//
+////////////////////////////////////////////////////////////////////
+//
+// MCLK = 48MHz / divider
+//      VCORE1 above 24MHz
+//      1 wait state above 12MHz (VCORE0 and VCORE1)
+//
+uint8_t static Gov_vcore(uint8_t divider){
+    return divider < 2;
+}
+uint8_t static Gov_wait(uint8_t divider){
+    return divider < 4;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_Init
+//
+////////////////////////////////////////////////////////////////////
+void Gov_Init(const Gov_cfg_t *cfg){
+    if(cfg)
+        Gov_cfg = *cfg;
+    else{
+        Gov_cfg.up = GOV_UP;
+        Gov_cfg.down = GOV_DOWN;
+        Gov_cfg.hold = GOV_HOLD;
+        Gov_cfg.slowest = GOV_SLOWEST;
+        Gov_cfg.period_us = GOV_PERIOD_US;
+    }
+    if(Gov_cfg.slowest == 0 || (Gov_cfg.slowest & (Gov_cfg.slowest - 1)))
+        Gov_cfg.slowest = 1;                // not a divider - stay at full speed
+    Gov_divider = Clock_MCLK_freq ? 48000000UL / Clock_MCLK_freq : 1;
+    Gov_changes = 0;
+    Gov_refused = 0;
+    Gov_quiet = 0;
+    Gov_started = 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_policy
+//
+////////////////////////////////////////////////////////////////////
+//
+// Up at once, down one step after hold quiet periods - a load between
+// the two thresholds keeps the speed and starts the quiet count again
+//
+uint8_t Gov_policy(uint8_t load){
+    uint8_t divider = Gov_divider;
+
+    if(load >= Gov_cfg.up){
+        Gov_quiet = 0;
+        return 1;
+    }
+    if(load >= Gov_cfg.down){
+        Gov_quiet = 0;
+        return divider;
+    }
+    if(++Gov_quiet < Gov_cfg.hold)
+        return divider;
+    Gov_quiet = 0;
+    return divider < Gov_cfg.slowest ? divider * 2 : divider;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_apply
+//
+////////////////////////////////////////////////////////////////////
+//
+// Faster - voltage, then wait states, then the clock
+// Slower - the clock, then wait states, then voltage
+// A Clock_48MHz_Divide return of 1 or 3 made no change - the voltage and
+// wait states go back to the current divider's. 2 (a clock not ready)
+// did change the dividers
+//
+int Gov_apply(uint8_t divider){
+    uint8_t now = Gov_divider;
+    int result;
+
+    if(divider == now)
+        return 0;
+
+    if(divider < now){
+        if(Gov_vcore(divider) > Gov_vcore(now) && Clock_VCORE_set(1))
+            return 4;
+        Clock_flash_wait(Gov_wait(divider));
+        result = Clock_48MHz_Divide(divider);
+        if(result == 1 || result == 3){
+            Clock_flash_wait(Gov_wait(now));
+            if(Gov_vcore(divider) > Gov_vcore(now))
+                Clock_VCORE_set(0);
+            return result;
+        }
+        Gov_divider = divider;
+        return result;
+    }
+
+    result = Clock_48MHz_Divide(divider);
+    if(result == 1 || result == 3)
+        return result;
+    Gov_divider = divider;
+    Clock_flash_wait(Gov_wait(divider));
+    if(Gov_vcore(divider) < Gov_vcore(now) && Clock_VCORE_set(0))
+        return 4;                           // still at VCORE1 - safe, costs power
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_update / Gov_poll
+//
+////////////////////////////////////////////////////////////////////
+uint8_t Gov_update(uint8_t load){
+    uint8_t divider = Gov_policy(load);
+
+    if(divider != Gov_divider){
+        if(Gov_apply(divider) == 0)
+            Gov_changes++;
+        else
+            Gov_refused++;
+    }
+    return Gov_divider;
+}
+
+//
+// load = 100 - 100 * slept / elapsed
+// (32 bit math - good for periods up to ~40s)
+//
+uint8_t Gov_poll(void){
+    uint32_t now = Time_now_us();
+    uint32_t sleep = Sched_sleep_us();
+    uint32_t elapsed = now - Gov_last_us;
+    uint32_t slept = sleep - Gov_last_sleep;
+    uint8_t load;
+
+    if(!Gov_started){
+        Gov_started = 1;
+        Gov_last_us = now;
+        Gov_last_sleep = sleep;
+        return Gov_divider;
+    }
+    if(elapsed < Gov_cfg.period_us)
+        return Gov_divider;
+    Gov_last_us = now;
+    Gov_last_sleep = sleep;
+    load = slept >= elapsed ? 0 : 100 - (uint8_t)((slept * 100) / elapsed);
+    return Gov_update(load);
+}
+
+#endif // __MSOE_LIB_GOV_C__
@@ -0,0 +1,123 @@
+/*
+ * msoe_lib_gov.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     load driven clock divider governor
+ *
+ */
+#ifndef __MSOE_LIB_GOV_H__
+#define __MSOE_LIB_GOV_H__
+////////////////////////////////////////////
+//
+// Clock Governor Routines
+//
+// Runs the CPU only as fast as the work needs - the load (time not
+// asleep in Sched_run) is measured over a period and the HFXT divider
+// (Clock_48MHz_Divide) follows it
+//      load above up       - straight to full speed (/1)
+//      load below down     - half the speed, once it has stayed below for
+//                            hold periods in a row (down to slowest)
+//      in between          - no change
+// A burst gets full speed on the first busy period, the clock only slows
+// after a quiet spell
+//
+// The core voltage and flash wait states are changed with the divider -
+// raised before a faster clock, lowered after a slower one
+//      /1  48MHz   AM_LDO_VCORE1   1 wait state
+//      /2  24MHz   AM_LDO_VCORE0   1 wait state
+//      /4  12MHz   AM_LDO_VCORE0   0 wait states
+//
+// Drivers follow the change through Clock_notify (SysTick tick, timebase,
+// LCD SPI clock) and can refuse it - the governor tries again on the next
+// period. Slower than /4 the timebase (msoe_lib_time) refuses - SMCLK is
+// no longer a whole number of MHz
+//
+//      Clock_Init_48MHz();
+//      Time_Init();
+//      Sched_clock(Time_now_us);
+//      Gov_Init(0);                        // default settings
+//      ...
+//      periodic task:  Gov_poll();
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+typedef struct {
+    uint8_t up;                     // load % to go to full speed
+    uint8_t down;                   // load % to slow down
+    uint8_t hold;                   // periods below down before slowing
+    uint8_t slowest;                // largest divider (1 to 128, power of 2)
+    uint32_t period_us;             // Gov_poll measurement period
+} Gov_cfg_t;
+
+//
+// Defaults - Gov_Init(0)
+//
+#define GOV_UP              80
+#define GOV_DOWN            30
+#define GOV_HOLD            3
+#define GOV_SLOWEST         4
+#define GOV_PERIOD_US       100000UL
+
+extern volatile uint8_t Gov_divider;        // divider now
+extern volatile uint32_t Gov_changes;       // divider changes made
+extern volatile uint32_t Gov_refused;       // changes refused or failed
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Starts the governor at the divider the clock is running at now
+// (Clock_Init_48MHz - /1)
+//
+// Inputs: settings, 0 for the defaults (copied)
+// Outputs: none
+//
+void Gov_Init(const Gov_cfg_t *cfg);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_poll / Gov_update
+//
+////////////////////////////////////////////////////////////////////
+//
+// Gov_poll - measures the load since the last period (Time_now_us and
+// Sched_sleep_us - Sched_clock must be set) and calls Gov_update once a
+// period has passed. Call more often than the period, from a task
+// Gov_update - one period's load, from any other measurement
+//
+// Inputs: none / load in % (0 to 100)
+// Outputs: divider now
+//
+uint8_t Gov_poll(void);
+uint8_t Gov_update(uint8_t load);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Gov_policy / Gov_apply
+//
+////////////////////////////////////////////////////////////////////
+//
+// The two halves of Gov_update
+// Gov_policy - the divider wanted for this load (counts the quiet
+// periods - call once a period)
+// Gov_apply - runs at a divider - voltage, wait states and clock in the
+// safe order. On a failure the voltage and wait states are put back
+//
+// Inputs: load in % / divider (1 to 128, power of 2)
+// Outputs: divider wanted / 0 for success
+//                           1 to 3 as Clock_48MHz_Divide (3 refused)
+//                           4 core voltage change failure
+//
+uint8_t Gov_policy(uint8_t load);
+int Gov_apply(uint8_t divider);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_GOV_H__
@@ -11,6 +11,34 @@
  *    	                                for printing the value 0
  *    	                            Added LCD_print_hex32 for printing 32bit hex
  *    	Rev:    0.3     9/13/17     Add a function to change the contrast LCD_contrast
+ *    	Rev:    0.4     10/17/26    Added a RAM framebuffer (DDRAM shadow) and
+ *    	                                LCD_flush - DMA transfer of the framebuffer
+ *    	                            LCD_clear and LCD_print_bmpArray use the DMA flush
+ *    	                                and now write all 504 locations
+ *    	                            Dirty span tracking - LCD_flush only sends changed
+ *    	                                columns of each bank, added buffered mode
+ *    	                            Command and Data writes are queued and sent by the
+ *    	                                eUSCI TX interrupt - no waiting on the SPI
+ *    	                            Pins and eUSCI come from a compile time I/O descriptor
+ *    	                                msoe_lib_lcd_alt_io.c builds this file with LCD_ALT_IO
+ *    	                            LCD_print_str and the big character routines render the
+ *    	                                glyph run into the framebuffer and send it as one
+ *    	                                flush - address commands only per bank
+ *    	                            Decimal printing uses Fmt_udec / Fmt_dec (msoe_lib_fmt)
+ *    	                                - no pow10 loops or divides, one string per number
+ *    	                            LCD_print_float uses Fmt_float_sci, added LCD_print_float_fix
+ *    	                            Big characters are copied from flattened 10 column strips
+ *    	                                (msoe_lib_lcd_bigfont.h) - '.' to '9' cached in SRAM
+ *    	                            Added LCD_print_bmpRLE - run length encoded bitmaps
+ *    	                                decoded straight into the framebuffer
+ *    	                            Added LCD_blit - sprites at any pixel x,y with
+ *    	                                overwrite / OR / XOR, 4 columns per word
+ *    	                            LCD_Config_pt - LCD_Config as a coroutine, reset
+ *    	                                hold and reconfiguration waits return to the caller
+ *    	                            SPI clock divider from the published SMCLK, follows
+ *    	                                SMCLK changes (Clock_notify)
+ *    	                            A full queue in a handler or with interrupts off is
+ *    	                                drained by the caller (LCD_txq_wait)
  *
  */
 #ifndef __MSOE_LIB_LCD_C__
@@ -132,33 +160,399 @@
 // CODE
 //
 #include <stdio.h>
-#include <float.h>
+#include <string.h>
 #include "msp432.h"
 #include "msoe_lib_lcd.h"
+#include "msoe_lib_fmt.h"
+#include "msoe_lib_clk.h"
 
+///////////   I/O descriptor   ///////////////////////////
+//
+// The eUSCI, DMA channel and pins used for the display
+// Selected at compile time - every access below is a direct register access
+//
+// default          eUSCI_A3 - P9.7 MOSI, P9.5 SCLK, P9.4 CS, P9.3 RST, P9.2 D/C
+// LCD_ALT_IO       eUSCI_A1 - P2.3 MOSI, P2.1 SCLK, P2.0 CS, P1.6 RST, P1.7 D/C
+//                      (msoe_lib_lcd_alt_io.c)
+//
+// eUSCI_Ax TX is DMA source 1 on channel 2x
+//
+#if defined(LCD_ALT_IO)
+#define LCD_EUSCI               EUSCI_A1
+#define LCD_EUSCI_IRQn          EUSCIA1_IRQn
+#define LCD_EUSCI_IRQHandler    EUSCIA1_IRQHandler
+#define LCD_DMA_CH              2
+#define LCD_SPI_PORT            P2
+#define LCD_SPI_PINS            0x0B        // P2.3, P2.1, P2.0
+#define LCD_CTL_PORT            P1
+#define LCD_RST_PIN             0x40        // P1.6
+#define LCD_DC_PIN              0x80        // P1.7
+#else
+#define LCD_EUSCI               EUSCI_A3
+#define LCD_EUSCI_IRQn          EUSCIA3_IRQn
+#define LCD_EUSCI_IRQHandler    EUSCIA3_IRQHandler
+#define LCD_DMA_CH              6
+#define LCD_SPI_PORT            P9
+#define LCD_SPI_PINS            0xB0        // P9.7, P9.5, P9.4
+#define LCD_CTL_PORT            P9
+#define LCD_RST_PIN             0x08        // P9.3
+#define LCD_DC_PIN              0x04        // P9.2
+#endif
+#define LCD_DMA_SRC             1
+
+///////////   Big character cache   ///////////////////////////
+//
+// LCD_BIG_CACHE 1 (default) copies the strips for '.' through '9' to SRAM
+// in LCD_Config - numeric displays then render without flash wait states
+// Build with LCD_BIG_CACHE=0 to save the 240 bytes of SRAM
+//
+#if !defined(LCD_BIG_CACHE)
+#define LCD_BIG_CACHE           1
+#endif
+#define LCD_BIG_CACHE_FIRST     '.'
+#define LCD_BIG_CACHE_LAST      '9'
+
+///////////   Framebuffer and DMA state   ///////////////////////////
+//
+// LCD_fb is a copy of the PCD8544 DDRAM - bank major, index = bank * 84 + column
+// LCD_fb_pos tracks the controller DDRAM address so data writes land in the
+// same framebuffer location the controller writes
+//
+// The DMA control table must be aligned to its size - 8 channels primary + alternate
+//
+
+typedef struct {
+    const volatile void *src_end;       // address of the last source byte
+    volatile void *dst_end;             // address of the last destination byte
+    uint32_t ctl;                       // channel control word
+    uint32_t spare;
+} LCD_dma_ctl_t;
+
+#if defined(__TI_COMPILER_VERSION__)
+#pragma DATA_ALIGN(LCD_dma_table, 256)
+static LCD_dma_ctl_t LCD_dma_table[16];
+#else
+static LCD_dma_ctl_t LCD_dma_table[16] __attribute__((aligned(256)));
+#endif
+
+static uint8_t LCD_fb[LCD_FB_SIZE];
+static uint16_t LCD_fb_pos = 0;
+static uint8_t LCD_addr_valid = 0;			// controller address matches LCD_fb_pos
+static uint8_t LCD_buffered_mode = 0;		// 1 - data writes only touch the framebuffer
+static void (*LCD_flush_cb)(void) = 0;
+
+//
+// LCD_Config_pt state
+// LCD_configured - set once the first configuration is done
+// LCD_reset_yields - returns to the caller while reset is held (at least
+// the 20 clocks of the old delay loop)
+//
+#define LCD_RESET_YIELDS	4
+static uint8_t LCD_configured = 0;
+static uint8_t LCD_reset_yields;
+
+//
+// Flush state
+// LCD_flush_state - 0 idle, 1 waiting for the TX queue to drain, 2 running
+// LCD_flush_again - LCD_flush was called while a flush was running
+//
+#define LCD_FLUSH_IDLE      0
+#define LCD_FLUSH_WAIT      1
+#define LCD_FLUSH_RUN       2
+static volatile uint8_t LCD_flush_state = LCD_FLUSH_IDLE;
+static volatile uint8_t LCD_flush_again = 0;
+
+//
+// TX queue - single producer (the caller), single consumer (LCD_EUSCI_IRQHandler)
+// Each entry is a message byte with its D/C level in bit 8
+// Size must be a power of 2
+//
+#define LCD_TXQ_SIZE        256
+#define LCD_TXQ_MASK        (LCD_TXQ_SIZE - 1)
+#define LCD_TXQ_DATA        0x0100
+static volatile uint16_t LCD_txq[LCD_TXQ_SIZE];
+static volatile uint16_t LCD_txq_head = 0;		// written by the caller only
+static volatile uint16_t LCD_txq_tail = 0;		// written by the interrupt only
+
+//
+// Dirty spans - one column span per bank changed since the last flush
+// A clean bank has lo > hi
+// The flush (DMA and TX interrupts) takes a span and marks it clean - the
+// drawing routines widen a span with interrupts off (LCD_fb_dirty)
+//
+static volatile uint8_t LCD_dirty_lo[LCD_BANKS] = {LCD_COLS, LCD_COLS, LCD_COLS, LCD_COLS, LCD_COLS, LCD_COLS};
+static volatile uint8_t LCD_dirty_hi[LCD_BANKS] = {0, 0, 0, 0, 0, 0};
+static uint8_t LCD_flush_bank = 0;			// next bank the flush looks at
+
+#if LCD_BIG_CACHE
+static uint8_t LCD_big_cache[LCD_BIG_CACHE_LAST - LCD_BIG_CACHE_FIRST + 1][2][ASCII_BIG_COLS];
+#endif
+
+
+//
+// Local routines
+//
+void static LCD_txq_put(uint8_t data, uint16_t dc);
+void static LCD_SPI_WR(uint8_t data, uint8_t dc);
+void static LCD_fb_write(uint16_t pos, uint8_t data);
+void static LCD_fb_copy(uint16_t pos, const uint8_t *src, uint8_t n);
+void static LCD_fb_fill(uint16_t pos, uint8_t data, uint8_t n);
+void static LCD_set_addr(uint8_t col, uint8_t bank);
+void static LCD_send_addr(void);
+void static LCD_fb_glyph(char val);
+const static uint8_t (*LCD_big_strip(char val))[ASCII_BIG_COLS];
+void static LCD_fb_bigglyph(uint8_t x, uint8_t y, char val);
+void static LCD_DMA_Config(void);
+void static LCD_blit_word(int16_t bank, uint8_t col, uint8_t n, uint32_t bits, uint32_t mask, uint8_t mode);
+void static LCD_flush_next(void);
+void LCD_EUSCI_IRQHandler(void);
+void DMA_INT1_IRQHandler(void);
 
 ///////////   Message write routines   ///////////////////////////
 //
+// Waiting for room in the queue
+//
+// The queue drains in the eUSCI TX and DMA_INT1 interrupts. Nothing sets NVIC
+// priorities, so from a handler (SysTick, a timer callback) or with
+// interrupts off they cannot run until the caller is done - the caller does
+// their work instead: the DMA done flag while a flush owns the SPI, the TX
+// flag otherwise, then the handler. Interrupts are off around it in case
+// they do have a higher priority. The handlers check their flag, so the
+// interrupt left pending finds nothing to do
+//
+void static LCD_txq_wait(void){
+  uint32_t int_state;
+  if(__get_IPSR() == 0 && __get_PRIMASK() == 0)	// thread mode - the interrupts drain it
+	  return;
+  int_state = _disable_interrupts();
+  if(LCD_flush_state == LCD_FLUSH_RUN){
+	  if(DMA_Channel->INT0_SRCFLG & (1 << LCD_DMA_CH))
+		  DMA_INT1_IRQHandler();
+  }
+  else if(LCD_EUSCI->IFG & 0x0002)
+	  LCD_EUSCI_IRQHandler();
+  _restore_interrupts(int_state);
+}
+//
+// Messages are queued with their D/C level and sent by the eUSCI TX interrupt
+// so the calling routine does not wait on the SPI
+//
+// 1) Wait for room in the queue (only when more than 255 bytes are waiting)
+// 2) Store the message and its D/C level
+// 3) Enable the TX interrupt - unless a flush owns the SPI, it re-enables it when done
+// note - TX only - no RX message to read
+//
+void static LCD_txq_put(uint8_t data, uint16_t dc){
+  uint16_t next = (LCD_txq_head + 1) & LCD_TXQ_MASK;
+  while(next == LCD_txq_tail)				// queue full - wait for the interrupt
+	  LCD_txq_wait();
+  LCD_txq[LCD_txq_head] = dc | data;
+  LCD_txq_head = next;						// publish the entry
+  if(LCD_flush_state != LCD_FLUSH_RUN)
+	  LCD_EUSCI->IE |= 0x0002;				// start (or keep) draining
+}
+//
+// Direct SPI write - used by the flush while it owns the SPI
+//
 // 1) Wait for the SPI TX buffer to be empty indicating any previous transmit has completed
 // 2) Set the D/C GPIO for Data or Command
 // 3) Load the message into the SPI TX buffer - transmit starts as soon as the register is loaded
-// note - TX only - no RX message to read
 //
-void static LCD_Data_WR(uint8_t data){
-  while((EUSCI_A3->IFG & 0x0002) == 0x0000) // Wait for Tx Buffer to be empty
+// D/C is sampled on the last bit of a byte so it is only changed
+// once the previous byte has left the shift register
+//
+void static LCD_SPI_WR(uint8_t data, uint8_t dc){
+  while((LCD_EUSCI->IFG & 0x0002) == 0x0000) // Wait for Tx Buffer to be empty
 	  ;
-  P9->OUT |= 0x04;							// Set D to 1 (data)
-  EUSCI_A3->TXBUF = data;                  	// load message and start transmit
-  while((EUSCI_A3->IFG & 0x0002) == 0x0000) // Wait for Tx Buffer to be empty
+  if(((LCD_CTL_PORT->OUT & LCD_DC_PIN) != 0) != dc){
+	  while(LCD_EUSCI->STATW & 0x0001)		// Wait for the shifter to finish
+		  ;
+	  LCD_CTL_PORT->OUT ^= LCD_DC_PIN;		// D/C - 1 data, 0 command
+  }
+  LCD_EUSCI->TXBUF = data;                  	// load message and start transmit
+  while((LCD_EUSCI->IFG & 0x0002) == 0x0000) // Wait for Tx Buffer to be empty
         ;
 }
+//
+// eUSCI TX interrupt
+//
+// Sends the next queued message - D/C is only changed when the level differs
+// from the previous message (waits at most one byte time for the shifter)
+// When the queue is empty the interrupt is disabled and a waiting flush is started
+// Nothing to do without the TX flag - LCD_txq_wait sent the byte
+//
+void LCD_EUSCI_IRQHandler(void){
+	uint16_t entry;
+	if((LCD_EUSCI->IFG & 0x0002) == 0x0000)
+		return;
+	if(LCD_txq_tail == LCD_txq_head){			// queue drained
+		LCD_EUSCI->IE &= ~0x0002;
+		if(LCD_flush_state == LCD_FLUSH_WAIT){
+			LCD_flush_state = LCD_FLUSH_RUN;
+			LCD_flush_bank = 0;
+			LCD_flush_next();
+		}
+		return;
+	}
+	entry = LCD_txq[LCD_txq_tail];
+	if((LCD_CTL_PORT->OUT ^ ((entry & LCD_TXQ_DATA) ? LCD_DC_PIN : 0)) & LCD_DC_PIN){	// D/C changes
+		while(LCD_EUSCI->STATW & 0x0001)
+			;
+		LCD_CTL_PORT->OUT ^= LCD_DC_PIN;
+	}
+	LCD_EUSCI->TXBUF = (uint8_t)entry;			// clears the TX flag
+	LCD_txq_tail = (LCD_txq_tail + 1) & LCD_TXQ_MASK;
+}
+//
+// Framebuffer write
+//
+// Only a changed byte marks its bank/column dirty
+//
+void static LCD_fb_write(uint16_t pos, uint8_t data){
+	uint8_t bank;
+	uint8_t col;
+	if(LCD_fb[pos] == data)
+		return;
+	LCD_fb[pos] = data;
+	bank = pos / LCD_COLS;
+	col = pos - bank * LCD_COLS;
+	LCD_fb_dirty(bank, col, col);
+}
+//
+// Framebuffer run copy
+//
+// Copies n bytes to consecutive locations from pos (wrapping like the
+// controller) - an unchanged run marks nothing, a changed run marks its whole
+// span dirty in each bank it touches
+//
+void static LCD_fb_copy(uint16_t pos, const uint8_t *src, uint8_t n){
+	uint8_t bank;
+	uint8_t col;
+	uint8_t run;
+	while(n){
+		bank = pos / LCD_COLS;
+		col = pos - bank * LCD_COLS;
+		run = (n < LCD_COLS - col) ? n : LCD_COLS - col;	// stop at the end of the bank
+		if(memcmp(&LCD_fb[pos], src, run) != 0){
+			memcpy(&LCD_fb[pos], src, run);
+			LCD_fb_dirty(bank, col, col + run - 1);
+		}
+		src += run;
+		n -= run;
+		pos += run;
+		if(pos == LCD_FB_SIZE)
+			pos = 0;
+	}
+}
+//
+// Framebuffer run fill
+//
+// n copies of data from pos - same dirty marking as LCD_fb_copy
+//
+void static LCD_fb_fill(uint16_t pos, uint8_t data, uint8_t n){
+	uint8_t bank;
+	uint8_t col;
+	uint8_t run;
+	uint8_t i;
+	while(n){
+		bank = pos / LCD_COLS;
+		col = pos - bank * LCD_COLS;
+		run = (n < LCD_COLS - col) ? n : LCD_COLS - col;
+		for(i=0; i<run && LCD_fb[pos + i] == data; i++)
+			;
+		if(i < run){
+			memset(&LCD_fb[pos], data, run);
+			LCD_fb_dirty(bank, col, col + run - 1);
+		}
+		n -= run;
+		pos += run;
+		if(pos == LCD_FB_SIZE)
+			pos = 0;
+	}
+}
+//
+// Data write
+//
+// Direct mode - the byte goes to the display and the framebuffer
+// Buffered mode - the byte goes to the framebuffer only and is sent by LCD_flush
+//
+// A waiting flush starts (TX interrupt) as soon as the queue drains and
+// sends its own X/Y addresses - the address check and the queued byte go
+// together with interrupts off, so a flush cannot start in between
+// Waits for room first (LCD_txq_wait)
+//
+void static LCD_Data_WR(uint8_t data){
+  uint32_t int_state;
+  if(LCD_buffered_mode){
+	  LCD_fb_write(LCD_fb_pos, data);
+  }
+  else{
+	  while(((LCD_txq_tail - LCD_txq_head - 1) & LCD_TXQ_MASK) < 3)	// X, Y and the byte
+		  LCD_txq_wait();
+	  int_state = _disable_interrupts();
+	  if(!LCD_addr_valid)					// cursor moved or a flush moved the controller address
+		  LCD_send_addr();
+	  LCD_fb[LCD_fb_pos] = data;			// keep the framebuffer in step with the DDRAM
+	  LCD_txq_put(data, LCD_TXQ_DATA);
+	  _restore_interrupts(int_state);
+  }
+  if(++LCD_fb_pos == LCD_FB_SIZE)			// controller wraps from 5,83 to 0,0
+	  LCD_fb_pos = 0;
+}
 void static LCD_Command_WR(uint8_t data){
-  while((EUSCI_A3->IFG & 0x0002) == 0x0000) // Wait for Tx Buffer to be empty
-	  ;
-  P9->OUT &= ~0x04;							// Set D to 0 (command)
-  EUSCI_A3->TXBUF = data;                  	// load message and start transmit
-  while((EUSCI_A3->IFG & 0x0002) == 0x0000) // Wait for Tx Buffer to be empty
-        ;
+  LCD_txq_put(data, 0);
+}
+//
+// DDRAM address
+//
+// col is a pixel column (0-83), bank is 0-5
+// Moves the framebuffer position only - the X and Y address commands are
+// sent by the next direct data write, or LCD_flush addresses each span
+//
+void static LCD_set_addr(uint8_t col, uint8_t bank){
+	LCD_fb_pos = bank * LCD_COLS + col;
+	LCD_addr_valid = 0;
+}
+void static LCD_send_addr(void){
+	LCD_Command_WR(0x80 | (LCD_fb_pos % LCD_COLS));	// 1 x6 x5 x4 x3 x2 x1 x0 : sets X location
+	LCD_Command_WR(0x40 | (LCD_fb_pos / LCD_COLS));	// 0100 0 y2 y1 y0 : sets Y location
+	LCD_addr_valid = 1;
+}
+//
+// Glyph rendering
+//
+// Character and big character columns are written to the framebuffer
+// (0x00 padding included) - the caller sends the run with LCD_flush
+//
+void static LCD_fb_glyph(char val){
+	uint8_t i;
+	LCD_fb_write(LCD_fb_pos, 0x00);				// First character column - blank
+	if(++LCD_fb_pos == LCD_FB_SIZE)				// wrap the same way the controller does
+		LCD_fb_pos = 0;
+	for(i=0; i<5; i++){
+		LCD_fb_write(LCD_fb_pos, ASCII[val - 0x20][i]);
+		if(++LCD_fb_pos == LCD_FB_SIZE)
+			LCD_fb_pos = 0;
+	}
+	LCD_fb_write(LCD_fb_pos, 0x00);				// Last character column - blank
+	if(++LCD_fb_pos == LCD_FB_SIZE)
+		LCD_fb_pos = 0;
+}
+const static uint8_t (*LCD_big_strip(char val))[ASCII_BIG_COLS]{
+#if LCD_BIG_CACHE
+	if((uint8_t)(val - LCD_BIG_CACHE_FIRST) <= (LCD_BIG_CACHE_LAST - LCD_BIG_CACHE_FIRST))
+		return LCD_big_cache[val - LCD_BIG_CACHE_FIRST];
+#endif
+	return ASCII_BIG_STRIP[val - ASCII_BIG_FIRST];
+}
+void static LCD_fb_bigglyph(uint8_t x, uint8_t y, char val){
+	uint16_t upper = (y * 2) * LCD_COLS + x * ASCII_BIG_COLS;	// upper half bank, first column
+	uint16_t lower = upper + LCD_COLS;							// lower half bank
+	const uint8_t (*strip)[ASCII_BIG_COLS] = LCD_big_strip(val);
+	LCD_fb_copy(upper, strip[0], ASCII_BIG_COLS);				// padding included
+	LCD_fb_copy(lower, strip[1], ASCII_BIG_COLS);
+	LCD_fb_pos = lower + ASCII_BIG_COLS;						// location after the lower half
+	LCD_addr_valid = 0;
 }
 
 ///////////   Configuration routines   ///////////////////////////
@@ -166,34 +560,95 @@ void static LCD_Command_WR(uint8_t data){
 // Port Configuration
 //
 void static LCD_Port_Config(void){
-	// SPI and LCD port mapping
-	// P9.7  MOSI, P9.5  SCLK, P9.4  CS
-	// P9.3  RST, P9.2  D/C
+	// SPI and LCD port mapping - see the I/O descriptor
+	// MOSI, SCLK, CS  LCD_SPI_PORT / LCD_SPI_PINS
+	// RST, D/C  LCD_CTL_PORT / LCD_RST_PIN, LCD_DC_PIN
 
-	P9->SEL0 |= 0xB0;		// 1x11 xxxx    P9.7, P9.5, and P9.4 as eUSCI (01) mode
-	P9->SEL1 &= ~0xB0;      // automatically set to outputs
+	LCD_SPI_PORT->SEL0 |= LCD_SPI_PINS;		// MOSI, SCLK and CS as eUSCI (01) mode
+	LCD_SPI_PORT->SEL1 &= ~LCD_SPI_PINS;	// automatically set to outputs
 
-	P9->SEL0 &= ~0x0C;		// xxxx 00xx     P9.3 and P9.2 as GPIO (00) mode
-	P9->SEL1 &= ~0x0C;
+	LCD_CTL_PORT->SEL0 &= ~(LCD_RST_PIN | LCD_DC_PIN);	// RST and D/C as GPIO (00) mode
+	LCD_CTL_PORT->SEL1 &= ~(LCD_RST_PIN | LCD_DC_PIN);
 
-	P9->DIR |= 0x0C;        // xxxx 11xx     P9.3 and P9.2 outputs
+	LCD_CTL_PORT->DIR |= LCD_RST_PIN | LCD_DC_PIN;		// RST and D/C outputs
+}
+//
+// SPI clock divider - SCLK as fast as the PCD8544 allows
+//
+#define LCD_SCLK_MAX		4000000
+uint16_t static LCD_SPI_brw(uint32_t smclk){
+	uint32_t brw = (smclk + LCD_SCLK_MAX - 1) / LCD_SCLK_MAX;
+	return brw ? brw : 1;
 }
 //
 // SPI Configuration
 //
-// P9.7  MOSI, P9.5  SCLK, P9.4  CS
+// MOSI, SCLK, CS on LCD_EUSCI
 // see MSP432 documentation for SPI registers and configuration
 //
 void static LCD_SPI_Config(void){
-	EUSCI_A3->CTLW0 = 0xAD83;	// 1010 ckph=1, ckpl=0, MSB first, 8 bit data
+	LCD_EUSCI->CTLW0 = 0xAD83;	// 1010 ckph=1, ckpl=0, MSB first, 8 bit data
 								// 1101 master, active low enable, synchronous
 								// 10xx clock=SMCLK
 								// xx11 CS active, SW reset activated
-	EUSCI_A3->MCTLW = 0;		// no modulation for SPI
-	// With a 48MHz HFXTCLK clock  set SCLK to 4MHz for PCD8544
-	EUSCI_A3->BRW = 0x03;		// 48MHz/4 -> 16MHz SMCLK /4 -> 4MHz SCLK
-	EUSCI_A3->IE &= ~0x0003;	// disable interrupt creation
-	EUSCI_A3->CTLW0 &= ~0x0001;	// release SW reset
+	LCD_EUSCI->MCTLW = 0;		// no modulation for SPI
+	// SCLK at most 4MHz for PCD8544 - 12MHz SMCLK (Clock_Init_48MHz) /3
+	LCD_EUSCI->BRW = LCD_SPI_brw(Clock_SMCLK_freq);
+	LCD_EUSCI->CTLW0 &= ~0x0001;	// release SW reset
+	LCD_EUSCI->IE &= ~0x0003;	// TX interrupt is enabled when messages are queued
+								// (IE is cleared by the SW reset)
+	NVIC->ISER[LCD_EUSCI_IRQn >> 5] = 1 << (LCD_EUSCI_IRQn & 0x1F);
+}
+//
+// New SPI clock divider - BRW only changes in SW reset, which clears IE
+//
+void static LCD_SPI_rate(uint32_t smclk){
+	uint16_t brw = LCD_SPI_brw(smclk);
+	uint16_t ie;
+	if(LCD_EUSCI->BRW == brw)
+		return;
+	ie = LCD_EUSCI->IE;
+	LCD_EUSCI->CTLW0 |= 0x0001;
+	LCD_EUSCI->BRW = brw;
+	LCD_EUSCI->CTLW0 &= ~0x0001;
+	LCD_EUSCI->IE = ie;
+}
+//
+// SMCLK change (Clock_notify)
+//
+// Refused while anything is being sent - the SW reset would cut it
+// A faster SMCLK gets the larger divider before the change so SCLK never
+// goes over the limit, a slower one gets the smaller divider after
+//
+uint8_t static LCD_clock(uint8_t when, const Clock_freq_t *next){
+	if(when == CLOCK_BEFORE){
+		if(LCD_txq_tail != LCD_txq_head || LCD_flush_state != LCD_FLUSH_IDLE
+		   || (LCD_EUSCI->STATW & 0x0001))
+			return 1;
+		if(next->smclk > Clock_SMCLK_freq)
+			LCD_SPI_rate(next->smclk);
+		return 0;
+	}
+	LCD_SPI_rate(next->smclk);
+	return 0;
+}
+//
+// DMA Configuration
+//
+// LCD_DMA_CH is triggered by the eUSCI TX flag
+// Completion is reported on DMA_INT1
+// note - the LCD driver owns the DMA control table base
+//
+void static LCD_DMA_Config(void){
+	DMA_Control->CFG = 0x01;							// master enable
+	DMA_Control->CTLBASE = (uintptr_t)LCD_dma_table;	// control table
+	DMA_Channel->CH_SRCCFG[LCD_DMA_CH] = LCD_DMA_SRC;	// eUSCI TX
+	DMA_Control->PRIOCLR = 1 << LCD_DMA_CH;				// default priority
+	DMA_Control->ALTCLR = 1 << LCD_DMA_CH;				// primary structure
+	DMA_Control->USEBURSTCLR = 1 << LCD_DMA_CH;			// single and burst requests
+	DMA_Control->REQMASKCLR = 1 << LCD_DMA_CH;			// allow peripheral requests
+	DMA_Channel->INT1_SRCCFG = 0x20 | LCD_DMA_CH;		// enable INT1 for the channel
+	NVIC->ISER[DMA_INT1_IRQn >> 5] = 1 << (DMA_INT1_IRQn & 0x1F);
 }
 //
 // LCD Module Configuration
@@ -205,17 +660,24 @@ void static LCD_SPI_Config(void){
 // 5) Set temp_coef/bias/Vop
 // 6) Turn on LCD and access Basic instructions
 // 7) Set display to normal mode - ready to accept Data transfers
-// 8) Clear display
+// 8) Configure the DMA
+// 9) Clear display
 //
-void LCD_Config(void){
+uint8_t LCD_Config_pt(Pt_t *pt){
+	uint8_t i;					// not kept across a yield
+
+	PT_BEGIN(pt);
+	// Reconfiguration - let queued messages and a running flush finish
+	// before the SPI is reset
+	PT_WAIT_UNTIL(pt, !LCD_configured || (LCD_txq_tail == LCD_txq_head && !LCD_flush_busy()));
+
 	LCD_SPI_Config();
 	LCD_Port_Config();
 
-	P9->OUT &= ~0x08;           // reset LCD -  Active low
-	int8_t i;
-	for(i=0; i<4; i++)			// delay for approx 20 clock cycles
-		;
-	P9->OUT |= 0x08;			// clear reset -  Active low
+	LCD_CTL_PORT->OUT &= ~LCD_RST_PIN;	// reset LCD -  Active low
+	for(LCD_reset_yields=0; LCD_reset_yields<LCD_RESET_YIELDS; LCD_reset_yields++)
+		PT_YIELD(pt);				// hold reset - at least 100ns
+	LCD_CTL_PORT->OUT |= LCD_RST_PIN;	// clear reset -  Active low
 
 	// LCD needs to access the extended instruction set to program
 	// the temp coef, bias system and VOP
@@ -233,7 +695,26 @@ void LCD_Config(void){
 								//     000 - active, horizontal entry mode, regular instruction set
 	LCD_Command_WR(0x0C);		// Display control - 0000 1 D 0 E
 								//     DE=10 -> normal mode
+	LCD_DMA_Config();
+#if LCD_BIG_CACHE
+	memcpy(LCD_big_cache, ASCII_BIG_STRIP[LCD_BIG_CACHE_FIRST - ASCII_BIG_FIRST], sizeof(LCD_big_cache));
+#endif
+	for(i=0; i<LCD_BANKS; i++)	// DDRAM content is unknown after reset
+		LCD_fb_dirty(i, 0, LCD_COLS - 1);
 	LCD_clear();				// Clear display
+	LCD_configured = 1;
+	Clock_notify(LCD_clock);	// SPI clock follows SMCLK
+	PT_END(pt);
+}
+//
+// Runs LCD_Config_pt to the end
+//
+void LCD_Config(void){
+	Pt_t pt;
+
+	PT_INIT(&pt);
+	while(PT_SCHEDULE(LCD_Config_pt(&pt)))
+		;
 }
 
 ///////////   Location routines   ///////////////////////////
@@ -244,8 +725,7 @@ void LCD_Config(void){
 // Each character is 7 pixels (columns) wide so must multiply Column position by 7
 //
 void LCD_goto_xy(uint8_t x, uint8_t y){
-	LCD_Command_WR(0x80 | (x * 7));		// 1 x6 x5 x4 x3 x2 x1 x0 : sets X location
-	LCD_Command_WR(0x40 | y);			// 0100 0 y2 y1 y0 : sets Y location
+	LCD_set_addr(x * 7, y);
 }
 //
 // Home
@@ -260,7 +740,7 @@ void LCD_home(void){
 // Set new character row value - keep existing column location
 // Range is 0 to 5
 void LCD_row(uint8_t row){
-	LCD_Command_WR(0x40 | row);			// 0100 0 y2 y1 y0 : sets Y location
+	LCD_set_addr(LCD_fb_pos % LCD_COLS, row);	// keep the column
 }
 //
 // Character column location
@@ -269,7 +749,7 @@ void LCD_row(uint8_t row){
 // Range is 0 to 11
 void LCD_col(uint8_t col){
 	// Each character is 7 pixels (columns) wide so must multiply Column position by 7
-	LCD_Command_WR(0x80 | (col * 7));	// 1 x6 x5 x4 x3 x2 x1 x0 : sets X location
+	LCD_set_addr(col * 7, LCD_fb_pos / LCD_COLS);	// keep the bank
 }
 
 ///////////   Display routines   ///////////////////////////
@@ -296,24 +776,33 @@ void LCD_print_char(char val){
 //
 // Display string
 //
-// The LCD controller automatically handles the wrap-around at the end of a row
+// The whole string is rendered into the framebuffer first, then direct mode
+// sends it as one flush - one X/Y address per bank and one DMA burst per span
+// instead of 7 queued writes per character (buffered mode waits for the next flush)
+// Wraps at the end of a row and from 5,83 to 0,0 like the controller
 void LCD_print_str(char *str_ptr){
 	while(*str_ptr != 0){					// check for end of string (ascii value 0)
-		LCD_print_char((char)(*str_ptr));	// print the current dereferenced value
+		LCD_fb_glyph((char)(*str_ptr));		// render the current dereferenced value
 	str_ptr++;								// advance to the next character
 	} // end while
+	LCD_addr_valid = 0;
+	if(!LCD_buffered_mode)
+		LCD_flush();
 }
 //
 // Clear display
 //
-// Cycle through each 8-bit column location and write all blanks
-// 6 banks x 84 columns = 504 8-bit column locations
-// The LCD controller automatically handles the wrap-around at the end of a row
+// Blank the framebuffer - only locations that were not already blank are marked dirty
+// Direct mode sends the changes with LCD_flush, buffered mode waits for the next flush
+// The display location returns to 0,0
 void LCD_clear(void){
-	LCD_goto_xy(0,0);
 	uint16_t i;
-	for(i=0; i<503; i++)
-		LCD_Data_WR(0x00);
+	for(i=0; i<LCD_FB_SIZE; i++)
+		LCD_fb_write(i, 0x00);
+	LCD_fb_pos = 0;
+	LCD_addr_valid = 0;
+	if(!LCD_buffered_mode)
+		LCD_flush();
 }
 //
 // BMP display
@@ -329,12 +818,49 @@ void LCD_clear(void){
 // Include the array in your project
 
 // 6 banks x 84 columns = 504 8-bit column locations
-// The LCD controller automatically handles the wrap-around at the end of a row
+// The bitmap is copied to the framebuffer - only changed locations are marked dirty
+// Direct mode sends the changes with LCD_flush, buffered mode waits for the next flush
 void LCD_print_bmpArray(const char *bmpArray_ptr){
-	LCD_goto_xy(0,0);
 	uint16_t i;
-	for(i=0; i<503; i++)
-		LCD_Data_WR(bmpArray_ptr[i]);
+	for(i=0; i<LCD_FB_SIZE; i++)
+		LCD_fb_write(i, bmpArray_ptr[i]);
+	LCD_fb_pos = 0;
+	LCD_addr_valid = 0;
+	if(!LCD_buffered_mode)
+		LCD_flush();
+}
+//
+// Run length encoded BMP display
+//
+// Packets are expanded directly into the framebuffer - no 504 byte copy of the
+// bitmap is made - the DMA flush then sends the changed spans
+// Decoding stops after 504 bytes, so a short run at the end is trimmed
+//
+void LCD_print_bmpRLE(const uint8_t *rle_ptr){
+	uint16_t pos = 0;
+	uint16_t n;
+	uint8_t c;
+	while(pos < LCD_FB_SIZE){
+		c = *rle_ptr++;
+		if(c & 0x80){							// run - the next byte repeats
+			n = (c & 0x7F) + 2;
+			if(n > LCD_FB_SIZE - pos)
+				n = LCD_FB_SIZE - pos;
+			LCD_fb_fill(pos, *rle_ptr++, n);
+		}
+		else{									// literal - c+1 bytes follow
+			n = c + 1;
+			if(n > LCD_FB_SIZE - pos)
+				n = LCD_FB_SIZE - pos;
+			LCD_fb_copy(pos, rle_ptr, n);
+			rle_ptr += c + 1;
+		}
+		pos += n;
+	}
+	LCD_fb_pos = 0;
+	LCD_addr_valid = 0;
+	if(!LCD_buffered_mode)
+		LCD_flush();
 }
 
 ///////////   Big character display routines   ///////////////////////////
@@ -351,25 +877,19 @@ void LCD_print_bmpArray(const char *bmpArray_ptr){
 // character location is required since there is no read capability on the controller
 // This also means no wrapping
 // Character indices are Row:0-2, Column:0-7
+// Both halves are rendered into the framebuffer, direct mode sends them with LCD_flush
 //
 void LCD_print_bigchar (uint8_t x, uint8_t y, char val ){
-	int8_t i;
-	LCD_Command_WR(0x80 | (x * 10));		// set x/y location for upper half
-	LCD_Command_WR(0x40 | (y * 2));
-	LCD_Data_WR(0x00);					// pad with 1 pixel space
-	for(i=0; i<8; i++) 					// cycle through 8 character pixels
-		LCD_Data_WR(ASCII_BIG[val - 0x20][i][0]);// correct offset and access upper row
-	LCD_Data_WR(0x00);					// pad with 1 pixel space
-	LCD_Command_WR(0x80 | (x * 10));		// set x/y location for lower half
-	LCD_Command_WR(0x40 | (y * 2 + 1));
-	LCD_Data_WR(0x00);					// pad with 2 pixel space
-	for(i=0; i<8; i++) 					// cycle through 8 character pixels
-		LCD_Data_WR(ASCII_BIG[val - 0x20][i][1]);// correct offset and access lower row
-	LCD_Data_WR(0x00);					// pad with 2 pixel space
+	LCD_fb_bigglyph(x, y, val);
+	if(!LCD_buffered_mode)
+		LCD_flush();
 }
 //
 // Display big string
 //
+// Consecutive characters on a row form one span per bank, so the flush
+// addresses each half row once instead of every character
+//
 void LCD_print_bigstr(uint8_t x, uint8_t y, char *str_ptr){
 	while(*str_ptr != 0){					// check for end of string (ascii value 0)
 		if(x >= 8){							// manage wrapping
@@ -378,10 +898,90 @@ void LCD_print_bigstr(uint8_t x, uint8_t y, char *str_ptr){
 		}
 		if(y == 3)
 			y = 0;
-		LCD_print_bigchar(x, y, (char)(*str_ptr));	// print the current dereferenced value
+		LCD_fb_bigglyph(x, y, (char)(*str_ptr));	// render the current dereferenced value
 		str_ptr++;								// advance to the next character
 		x++;									// advance to next character location
 	} // end while
+	if(!LCD_buffered_mode)
+		LCD_flush();
+}
+
+///////////   Sprite routines   ///////////////////////////
+//
+// Sprite blit
+//
+// A 32 bit word holds the same bank byte of 4 adjacent columns. Shifting the
+// word by the pixel offset and masking each byte lane splits every column byte
+// into the part for the destination bank (lo) and the part that spills into
+// the next bank down (hi) - 4 columns per shift, no per pixel work
+//
+#define LCD_LANES(b)	((uint32_t)(b) * 0x01010101UL)	// byte b in all 4 lanes
+
+void static LCD_blit_word(int16_t bank, uint8_t col, uint8_t n, uint32_t bits, uint32_t mask, uint8_t mode){
+	uint8_t *dst;
+	uint32_t old = 0;
+	uint32_t val;
+	if(bank < 0 || bank >= LCD_BANKS)				// clipped above or below the display
+		return;
+	dst = &LCD_fb[bank * LCD_COLS + col];
+	if(n == 4)
+		memcpy(&old, dst, 4);						// one unaligned word load
+	else
+		memcpy(&old, dst, n);
+	if(mode == LCD_BLIT_OR)
+		val = old | bits;
+	else if(mode == LCD_BLIT_XOR)
+		val = old ^ bits;
+	else
+		val = (old & ~mask) | bits;
+	if(val == old)
+		return;
+	if(n == 4)
+		memcpy(dst, &val, 4);
+	else
+		memcpy(dst, &val, n);
+	LCD_fb_dirty(bank, col, col + n - 1);
+}
+void LCD_blit(int16_t x, int16_t y, const uint8_t *sprite, uint8_t w, uint8_t h, uint8_t stride, uint8_t mode){
+	int16_t bank;									// bank of the first sprite row
+	uint8_t shift;									// pixel offset inside that bank
+	int16_t c0;										// first visible sprite column
+	int16_t c1;										// one past the last visible column
+	uint8_t rows = (h + 7) >> 3;
+	uint8_t r;
+	int16_t c;
+	uint8_t n;
+	uint32_t m;										// sprite pixels in each lane
+	uint32_t lo_lane;
+	uint32_t hi_lane;
+	uint32_t v;
+
+	if(w == 0 || h == 0)
+		return;
+	bank = (y < 0) ? -((7 - y) >> 3) : (y >> 3);	// round down for negative y
+	shift = (uint8_t)(y - bank * 8);
+	c0 = (x < 0) ? -x : 0;
+	c1 = (x + w > LCD_COLS) ? LCD_COLS - x : w;
+	lo_lane = LCD_LANES((uint8_t)(0xFF << shift));
+	hi_lane = LCD_LANES(0xFF >> (8 - shift));		// 0 when shift is 0
+
+	for(r=0; r<rows; r++){
+		m = LCD_LANES((r == rows - 1 && (h & 7)) ? (1 << (h & 7)) - 1 : 0xFF);
+		for(c=c0; c<c1; c+=n){
+			n = (c1 - c < 4) ? c1 - c : 4;
+			v = 0;
+			if(n == 4)
+				memcpy(&v, &sprite[r * stride + c], 4);
+			else
+				memcpy(&v, &sprite[r * stride + c], n);
+			v &= m;
+			LCD_blit_word(bank + r, x + c, n, (v << shift) & lo_lane, (m << shift) & lo_lane, mode);
+			if(shift)
+				LCD_blit_word(bank + r + 1, x + c, n, (v >> (8 - shift)) & hi_lane, (m >> (8 - shift)) & hi_lane, mode);
+		}
+	}
+	if(!LCD_buffered_mode)
+		LCD_flush();
 }
 
 ///////////   Number display routines   ///////////////////////////
@@ -514,38 +1114,15 @@ void LCD_print_hex32(uint32_t val){
         LCD_print_char(val_tmp + 0x37);
 }
 //
-// Helper function to avoid the use of the math library
-//
-// Calculate POSITIVE powers of 10
-//
-int static pow10(uint8_t exp){
-	int8_t i;
-	int pow = 1;
-	for(i=0; i<exp; i++)
-		pow *= 10;
-	return pow;
-}
-//
 // Display 3 digit unsigned Decimal
 //
 // supports 8 bit unsigned values
+// The digits are formatted by Fmt_udec and sent as one string
 //
 void LCD_print_udec3(uint8_t val){
-	int8_t i;
-	uint8_t val_tmp = val;
-	for(i=2; i>=0; i--){
-	    if(i == 0 && val == 0){
-	        LCD_print_char('0');
-	    }
-	    else if(val >= (pow10(i))){
-			val_tmp = val_tmp / (pow10(i));
-			LCD_print_char(val_tmp + 0x30);
-		}
-		else{
-			LCD_print_char(' ');
-		}
-		val_tmp = val % (int)pow10(i);
-	}
+	char buf[FMT_DEC_BUF];
+	Fmt_udec(buf, val, 3);
+	LCD_print_str(buf);
 }
 //
 // Display 5 digit unsigned Decimal
@@ -553,21 +1130,9 @@ void LCD_print_udec3(uint8_t val){
 // supports 16 bit unsigned values
 //
 void LCD_print_udec5(uint16_t val){
-	int8_t i;
-	uint16_t val_tmp = val;
-	for(i=4; i>=0; i--){
-	    if(i == 0 && val == 0){
-            LCD_print_char('0');
-	    }
-	    else if(val >= (pow10(i))){
-			val_tmp = val_tmp / (pow10(i));
-			LCD_print_char(val_tmp + 0x30);
-		}
-		else{
-			LCD_print_char(' ');
-		}
-		val_tmp = val % (int)pow10(i);
-	}
+	char buf[FMT_DEC_BUF];
+	Fmt_udec(buf, val, 5);
+	LCD_print_str(buf);
 }
 //
 // Display 10 digit unsigned Decimal
@@ -575,48 +1140,20 @@ void LCD_print_udec5(uint16_t val){
 // supports 32 bit unsigned values
 //
 void LCD_print_udec10(uint32_t val){
-	int8_t i;
-	uint32_t val_tmp = val;
-	for(i=9; i>=0; i--){
-	    if(i == 0 && val == 0){
-	        LCD_print_char('0');
-	    }
-	    else if(val >= (pow10(i))){
-			val_tmp = val_tmp / (pow10(i));
-			LCD_print_char(val_tmp + 0x30);
-		}
-		else{
-			LCD_print_char(' ');
-		}
-		val_tmp = val % (int)pow10(i);
-	}
+	char buf[FMT_DEC_BUF];
+	Fmt_udec(buf, val, 10);
+	LCD_print_str(buf);
 }
 //
 // Display 3 digit signed Decimal
 //
 // supports 8 bit signed values
+// Negative values are preceded by '-'
 //
 void LCD_print_dec3(int8_t val){
-	int8_t i;
-	int8_t val_tmp =val;
-	if(val < 0){
-		LCD_print_char('-');
-		val *= -1;
-		val_tmp *= -1;
-	}
-	for(i=2; i>=0; i--){
-	    if(i == 0 && val == 0){
-	        LCD_print_char('0');
-	    }
-	    else if(val >= (pow10(i))){
-			val_tmp = val_tmp / (pow10(i));
-			LCD_print_char(val_tmp + 0x30);
-		}
-		else{
-			LCD_print_char(' ');
-		}
-		val_tmp = val % (int)pow10(i);
-	}
+	char buf[FMT_DEC_BUF];
+	Fmt_dec(buf, val, 3);
+	LCD_print_str(buf);
 }
 //
 // Display 5 digit signed Decimal
@@ -624,26 +1161,9 @@ void LCD_print_dec3(int8_t val){
 // supports 16 bit signed values
 //
 void LCD_print_dec5(int16_t val){
-	int8_t i;
-	int16_t val_tmp = val;
-	if(val < 0){
-		LCD_print_char('-');
-		val *= -1;
-		val_tmp *= -1;
-	}
-	for(i=4; i>=0; i--){
-	    if(i == 0 && val == 0){
-	        LCD_print_char('0');
-	    }
-	    else if(val >= (pow10(i))){
-			val_tmp = val_tmp / (pow10(i));
-			LCD_print_char(val_tmp + 0x30);
-		}
-		else{
-			LCD_print_char(' ');
-		}
-		val_tmp = val % (int)pow10(i);
-	}
+	char buf[FMT_DEC_BUF];
+	Fmt_dec(buf, val, 5);
+	LCD_print_str(buf);
 }
 //
 // Display 10 digit signed Decimal
@@ -651,84 +1171,30 @@ void LCD_print_dec5(int16_t val){
 // supports 32 bit signed values
 //
 void LCD_print_dec10(int32_t val){
-	int8_t i;
-	int32_t val_tmp = val;
-	if(val < 0){
-		LCD_print_char('-');
-		val *= -1;
-		val_tmp *= -1;
-	}
-	for(i=9; i>=0; i--){
-	    if(i == 0 && val == 0){
-	        LCD_print_char('0');
-	    }
-	    else if(val >= (pow10(i))){
-			val_tmp = val_tmp / (pow10(i));
-			LCD_print_char(val_tmp + 0x30);
-		}
-		else{
-			LCD_print_char(' ');
-		}
-		val_tmp = val % (int)pow10(i);
-	}
+	char buf[FMT_DEC_BUF];
+	Fmt_dec(buf, val, 10);
+	LCD_print_str(buf);
 }
 //
-// Helper function to avoid the use of the math library
+// Display float in scientific notation
 //
-// Calculate powers of 10 as a float
+// x.xxxxExx - formatted by Fmt_float_sci from the IEEE bits (no float search)
 //
-float static pow10f(int8_t exp){
-	int8_t i;
-	float pow = 1.0;
-	if(exp >= 0){
-		for(i=0; i<exp; i++)
-		pow *= 10;
-	}else{
-		for(i=0; i>exp; i--)
-		pow /= 10;
-	}
-	return pow;
+void LCD_print_float(float val){
+	char buf[FMT_DEC_BUF];
+	Fmt_float_sci(buf, val);
+	LCD_print_str(buf);
 }
 //
-// Display float in scientific notation
+// Display float in fixed point
 //
-// x.xxxxExx
+// int_width digits, '.', frac digits - e.g. xx.x is LCD_print_float_fix(val, 2, 1)
+// formatted by Fmt_float_fix, '*' fill when the value does not fit
 //
-void LCD_print_float(float val){
-	int8_t exp = -38;
-	uint16_t pow = 10000;
-	if(val < 0){									// if negative print '-' and make positive
-		val *= -1;
-		LCD_print_char('-');
-	}
-
-	while(val >= pow10f(exp+1))						// calculate exponent
-		exp++;
-
-	val = pow * val * pow10f(0 - exp);				// adjust value to xxxxx.xx form
-	val += (pow * FLT_EPSILON * 10);					// since we know magnitude of number - add epsilon*10 to correct for rounding
-
-	int val_tmp = ((int)val);						// now in form xxxxx
-	uint8_t i;										// print 1st digit and decimal point
-	val_tmp = val / pow;
-	val -= val_tmp * pow;
-	pow /= 10;
-	LCD_print_char(val_tmp + 0x30);
-	LCD_print_char('.');
-	for(i=1; i<5; i++){								// print remaining digits
-		val_tmp = val / pow;
-		val -= val_tmp * pow;
-		pow /= 10;
-		LCD_print_char(val_tmp + 0x30);
-	}
-	LCD_print_char('E');							// print E for exponent and '-' if negative
-	if(exp < 0){
-		LCD_print_char('-');
-		exp *= -1;
-	}
-	if(exp > 9)										// print exponent
-		LCD_print_char((exp / 10) + 0x30);
-	LCD_print_char((exp % 10) + 0x30);
+void LCD_print_float_fix(float val, uint8_t int_width, uint8_t frac){
+	char buf[FMT_DEC_BUF];
+	Fmt_float_fix(buf, val, int_width, frac);
+	LCD_print_str(buf);
 }
 
 //
@@ -763,4 +1229,161 @@ void LCD_contrast(uint8_t val){
                                 //     DE=10 -> normal mode
 }
 
+///////////   Framebuffer routines   ///////////////////////////
+//
+// Framebuffer access
+//
+// Returns the 504 byte framebuffer - bank major, index = bank * 84 + column
+// Wait for LCD_flush_busy() to return 0 before changing it
+//
+uint8_t *LCD_framebuffer(void){
+	return LCD_fb;
+}
+//
+// Flush the framebuffer
+//
+// Sends the dirty span of each bank - X/Y address commands then the span data
+// The span data is streamed to the eUSCI TX buffer with DMA channel LCD_DMA_CH
+// and the DMA interrupt starts the next span - returns without waiting
+// Spans that run from the end of one bank into the start of the next are
+// sent as one transfer since the controller wraps to the next bank
+// The first byte of a transfer is loaded by hand - the TX flag edge it
+// produces starts the channel for the remaining bytes
+//
+// The flush owns the SPI while it runs - queued messages wait (TX interrupt off)
+// and are sent when it completes
+//
+void static LCD_flush_next(void){
+	uint8_t bank;
+	uint8_t last;
+	uint16_t start;
+	uint16_t end;
+
+	while(1){
+		for(bank = LCD_flush_bank; bank < LCD_BANKS; bank++)	// find the next dirty bank
+			if(LCD_dirty_lo[bank] <= LCD_dirty_hi[bank])
+				break;
+		if(bank == LCD_BANKS){
+			if(LCD_flush_again){							// flush requested while running
+				LCD_flush_again = 0;
+				LCD_flush_bank = 0;
+				continue;
+			}
+			LCD_flush_state = LCD_FLUSH_IDLE;				// all done
+			LCD_addr_valid = 0;
+			if(LCD_txq_tail != LCD_txq_head)				// release the SPI to the queue
+				LCD_EUSCI->IE |= 0x0002;
+			if(LCD_flush_cb)
+				LCD_flush_cb();
+			return;
+		}
+
+		last = bank;										// join spans across bank wraps
+		while(last + 1 < LCD_BANKS && LCD_dirty_hi[last] == LCD_COLS - 1 &&
+			  LCD_dirty_lo[last + 1] == 0)
+			last++;
+		start = bank * LCD_COLS + LCD_dirty_lo[bank];
+		end = last * LCD_COLS + LCD_dirty_hi[last];
+		for(LCD_flush_bank = bank; LCD_flush_bank <= last; LCD_flush_bank++){
+			LCD_dirty_lo[LCD_flush_bank] = LCD_COLS;
+			LCD_dirty_hi[LCD_flush_bank] = 0;
+		}
+
+		LCD_addr_valid = 0;									// direct writes address again
+		LCD_SPI_WR(0x80 | (start - bank * LCD_COLS), 0);	// X address
+		LCD_SPI_WR(0x40 | bank, 0);							// Y address
+		if(start != end)
+			break;
+		LCD_SPI_WR(LCD_fb[start], 1);						// single byte - no DMA
+	}
+
+	while(LCD_EUSCI->STATW & 0x0001)							// D/C is sampled on the last bit
+		;
+	LCD_CTL_PORT->OUT |= LCD_DC_PIN;						// Set D to 1 (data)
+	LCD_dma_table[LCD_DMA_CH].src_end = &LCD_fb[end];
+	LCD_dma_table[LCD_DMA_CH].dst_end = &LCD_EUSCI->TXBUF;
+	LCD_dma_table[LCD_DMA_CH].ctl = 0xC0000000 |				// dst no increment, byte
+									((end - start - 1) << 4) |	// n - 1 transfers
+									0x01;						// basic mode
+	DMA_Control->ENASET = 1 << LCD_DMA_CH;
+	LCD_EUSCI->TXBUF = LCD_fb[start];						// hand load starts the channel
+}
+//
+// Starts right away when the TX queue is empty, otherwise the TX interrupt
+// starts it once the queued messages are sent
+// Calling it while a flush runs makes that flush go around again
+//
+void LCD_flush(void){
+	uint32_t int_state = _disable_interrupts();
+	LCD_addr_valid = 0;					// the flush moves the controller address
+	if(LCD_flush_state != LCD_FLUSH_IDLE){
+		LCD_flush_again = 1;
+	}
+	else if(LCD_txq_tail != LCD_txq_head){
+		LCD_flush_state = LCD_FLUSH_WAIT;
+	}
+	else{
+		LCD_flush_state = LCD_FLUSH_RUN;
+		LCD_flush_bank = 0;
+		LCD_flush_next();
+	}
+	_restore_interrupts(int_state);
+}
+//
+// Mark part of the framebuffer dirty
+//
+// Use after changing the framebuffer through LCD_framebuffer()
+// bank 0-5, columns col_lo to col_hi (0-83)
+// Interrupts off - a flush taking the span between the lo and hi updates
+// would leave lo > hi and the change would never be sent
+//
+void LCD_fb_dirty(uint8_t bank, uint8_t col_lo, uint8_t col_hi){
+	uint32_t int_state = _disable_interrupts();
+	if(col_lo < LCD_dirty_lo[bank])
+		LCD_dirty_lo[bank] = col_lo;
+	if(col_hi > LCD_dirty_hi[bank])
+		LCD_dirty_hi[bank] = col_hi;
+	_restore_interrupts(int_state);
+}
+//
+// Buffered mode
+//
+// 1 - drawing routines only change the framebuffer, LCD_flush sends the changes
+// 0 - drawing routines write the display directly (default)
+//
+void LCD_buffered(uint8_t on){
+	LCD_buffered_mode = on;
+	LCD_addr_valid = 0;
+}
+//
+// Flush status
+//
+// Returns 1 while a flush is in progress
+//
+uint8_t LCD_flush_busy(void){
+	return (LCD_flush_state != LCD_FLUSH_IDLE) || LCD_flush_again;
+}
+//
+// Flush completion callback
+//
+// callback runs in interrupt context when a flush completes - 0 for none
+//
+void LCD_flush_callback(void (*callback)(void)){
+	LCD_flush_cb = callback;
+}
+//
+// DMA completion interrupt
+//
+// The channel is done when the last byte is loaded into the TX buffer
+// LCD_SPI_WR and the TX interrupt wait for it to leave the shift register
+// before changing D/C
+// Nothing to do without the done flag - LCD_txq_wait ran the next span
+//
+void DMA_INT1_IRQHandler(void){
+	if((DMA_Channel->INT0_SRCFLG & (1 << LCD_DMA_CH)) == 0)
+		return;
+	DMA_Channel->INT0_CLRFLG = 1 << LCD_DMA_CH;
+	LCD_flush_next();
+}
+
 #endif //__MSOE_LIB_LCD_C__
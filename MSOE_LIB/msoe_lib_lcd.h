@@ -11,6 +11,24 @@
  *                                      for printing the value 0
  *                                  Added LCD_print_hex32 for printing 32bit hex
  *      Rev:    0.3     9/13/17     Add a function to change the contrast LCD_contrast
+ *      Rev:    0.4     10/17/26    Added a RAM framebuffer (DDRAM shadow) and
+ *                                      LCD_flush - DMA transfer of the framebuffer
+ *                                  Dirty span tracking - LCD_flush only sends changed
+ *                                      columns of each bank, added buffered mode
+ *                                  Command and Data writes are queued and sent by the
+ *                                      eUSCI TX interrupt - no waiting on the SPI
+ *                                  One driver for both pinouts - msoe_lib_lcd_alt_io.c
+ *                                      builds msoe_lib_lcd.c with LCD_ALT_IO
+ *                                  Strings and big characters are rendered into the
+ *                                      framebuffer and sent as one flush
+ *                                  Decimal and float printing formatted by msoe_lib_fmt
+ *                                      added LCD_print_float_fix
+ *                                  Big characters use the flattened strips in
+ *                                      msoe_lib_lcd_bigfont.h, '.'-'9' cached in SRAM
+ *                                  Added LCD_print_bmpRLE for run length encoded bitmaps
+ *                                  Added LCD_blit - sprites at any pixel location
+ *                                  Added LCD_Config_pt - LCD_Config as a coroutine
+ *                                  SPI clock follows SMCLK changes (Clock_notify)
  *
  */
 #ifndef __MSOE_LIB_LCD_H__
@@ -88,6 +106,8 @@
 // SCLK       				pin 7	P9.5	output
 // LED (back light)    		pin 8 	N/C
 //
+// Alternate pinout (eUSCI_A1) - see msoe_lib_lcd_alt_io.h
+//
 ////////////////////////////////////////////////////////////////
 //
 // PCD8544 Programming
@@ -131,14 +151,32 @@
 //
 // CODE
 //
+#include "msoe_lib_pt.h"
 #include "msoe_lib_lcd_char.h"
+#include "msoe_lib_lcd_bigfont.h"
+
+//
+// Display geometry
+//
+#define LCD_COLS        84                      // pixel columns
+#define LCD_BANKS       6                       // 8 pixel tall banks
+#define LCD_FB_SIZE     (LCD_COLS * LCD_BANKS)  // 504 DDRAM locations
 
 ///////////   Message write routines   ///////////////////////////
 //
-// 1) Wait for the SPI TX buffer to be empty indicating any previous transmit has completed
-// 2) Set the D/C GPIO for Data or Command
-// 3) Load the message into the SPI TX buffer - transmit starts as soon as the register is loaded
-// note - TX only - no RX message to read
+// Messages are queued with their D/C level (256 entries) and sent by the
+// eUSCI TX interrupt, so the print routines return without waiting on the SPI
+//
+// The queue has a single producer - call the LCD routines from one context
+// (the main loop or one interrupt, e.g. a Timer_start callback). A full queue
+// waits for the eUSCI and DMA_INT1 interrupts - in a handler or with
+// interrupts off the print routine sends the bytes itself (polled)
+//
+// D/C is only changed when it differs from the previous message, and only
+// once the previous byte has left the shift register
+//
+// Direct mode - data goes to the display and the framebuffer
+// Buffered mode - data goes to the framebuffer only
 //
 void static LCD_Data_WR(uint8_t data);
 void static LCD_Command_WR(uint8_t data);
@@ -152,7 +190,7 @@ void static LCD_Port_Config(void);
 //
 // SPI Configuration
 //
-// P9.7  MOSI, P9.5  SCLK, P9.4  CS
+// P9.7  MOSI, P9.5  SCLK, P9.4  CS (eUSCI_A3)
 // see MSP432 documentation for SPI registers and configuration
 //
 void static LCD_SPI_Config(void);
@@ -167,10 +205,29 @@ void static LCD_SPI_Config(void);
 // 5) Set temp_coef/bias/Vop
 // 6) Turn on LCD and access Basic instructions
 // 7) Set display to normal mode - ready to accept Data transfers
-// 8) Clear display
+// 8) Configure the DMA
+// 9) Clear display
+//
+// The SPI clock is set from the published SMCLK (msoe_lib_clk) and follows
+// Clock_48MHz_Divide - a divide is refused while the LCD is sending
 //
 void LCD_Config(void);
 
+//
+// LCD_Config as a coroutine (msoe_lib_pt.h)
+//
+// Returns to the caller while the reset is held and, when called again to
+// reconfigure, until queued messages and a running flush are sent (needs
+// the LCD interrupts) - other start up or the main loop runs meanwhile
+// The display clear is started (LCD_flush_busy) when it returns PT_ENDED
+//
+//      Pt_t lcd;
+//      PT_INIT(&lcd);
+//      while(PT_SCHEDULE(LCD_Config_pt(&lcd)))
+//          other_work();
+//
+uint8_t LCD_Config_pt(Pt_t *pt);
+
 ///////////   Location routines   ///////////////////////////
 //
 // Character X-Y location
@@ -217,15 +274,17 @@ void LCD_print_char(char val);
 //
 // Display string
 //
-// The LCD controller automatically handles the wrap-around at the end of a row
+// The string is rendered into the framebuffer and sent as one flush
+// (direct mode) - address commands only per bank, one DMA burst per span
+// Wraps at the end of a row like the LCD controller
 void LCD_print_str(char *str_ptr);
 
 //
 // Clear display
 //
-// Cycle through each 8-bit column location and write all blanks
+// Blank the framebuffer - direct mode sends the changed locations with LCD_flush
 // 6 banks x 84 columns = 504 8-bit column locations
-// The LCD controller automatically handles the wrap-around at the end of a row
+// The display location returns to 0,0
 void LCD_clear(void);
 
 //
@@ -236,9 +295,27 @@ void LCD_clear(void);
 // Use the Cypress program Bitmap_to_C.exe program to convert the bitmap to an array
 //
 // 6 banks x 84 columns = 504 8-bit column locations
-// The LCD controller automatically handles the wrap-around at the end of a row
+// The array is copied to the framebuffer - direct mode sends the changed
+// locations with LCD_flush
 void LCD_print_bmpArray(const char *bmpArray_ptr);
 
+//
+// Run length encoded BMP display
+//
+// Same result as LCD_print_bmpArray from a compressed array - typically a
+// third of the flash or less for logos and icon screens
+// host/bmp_rle_gen.c converts a bitmap array header, e.g.
+//      ./bmp_rle_gen pu1 pu1.h > pu1_rle.h         -> pu1_rle[]
+//
+// Format - packets in DDRAM order (bank 0 column 0 to bank 5 column 83)
+// expanding to exactly 504 bytes
+//      0x00-0x7F   c+1 literal bytes follow
+//      0x80-0xFF   the next byte repeats (c & 0x7F)+2 times
+//
+// The packets are decoded directly into the framebuffer, only changed
+// locations are marked dirty - direct mode sends them with LCD_flush
+void LCD_print_bmpRLE(const uint8_t *rle_ptr);
+
 ///////////   Big character display routines   ///////////////////////////
 //
 // Display big character
@@ -247,19 +324,50 @@ void LCD_print_bmpArray(const char *bmpArray_ptr);
 // Cypress big characters are 18 pixels tall
 // Display characters add 2 columns of pixels either side of the Cypress character
 // Characters are stored in the 3-D array ASCII_BIG and indexed (offset) by 0x20
+// The driver copies the flattened form ASCII_BIG_STRIP (msoe_lib_lcd_bigfont.h,
+// generated from ASCII_BIG by host/bigfont_gen.c) - rerun the generator after
+// changing ASCII_BIG
 // The RAM stores the data (1 byte) as a column 8 bits tall with the LSB at the top
 // when in Horizontal addressing mode
 // Since the characters span more than 1 row (bank) explicit control of the
 // character location is required since there is no read capability on the controller
 // This also means no wrapping
 // Character indices are Row:0-2, Column:0-7
+// Direct mode sends the character with LCD_flush
 void LCD_print_bigchar (uint8_t x, uint8_t y, char val );
 
 //
 // Display big string
 //
+// All characters are rendered first and sent as one flush (direct mode)
+// Each half row of consecutive characters is addressed once
+//
 void LCD_print_bigstr(uint8_t x, uint8_t y, char *str_ptr);
 
+///////////   Sprite routines   ///////////////////////////
+//
+// Sprite blit
+//
+// Draws a w x h pixel sprite with its top left pixel at x,y (pixels, 0-83 and
+// 0-47) - parts outside the display are clipped, x and y may be negative
+//
+// The sprite is laid out like the display - (h+7)/8 bank rows of w column
+// bytes, LSB at the top, stride bytes from one bank row to the next
+// (stride = w for a sprite on its own, 84 for part of a full screen bitmap
+// such as bat1 - pass the address of its first byte)
+//
+// mode     LCD_BLIT_OVERWRITE  sprite pixels replace the display (both 0 and 1)
+//          LCD_BLIT_OR         set pixels are drawn, clear pixels are transparent
+//          LCD_BLIT_XOR        set pixels invert the display - blit again to erase
+//
+// Works on the framebuffer 4 columns at a time - only changed columns are
+// marked dirty, direct mode sends them with LCD_flush
+//
+#define LCD_BLIT_OVERWRITE      0
+#define LCD_BLIT_OR             1
+#define LCD_BLIT_XOR            2
+void LCD_blit(int16_t x, int16_t y, const uint8_t *sprite, uint8_t w, uint8_t h, uint8_t stride, uint8_t mode);
+
 ///////////   Number display routines   ///////////////////////////
 //
 // Display binary
@@ -281,12 +389,6 @@ void LCD_print_hex16(uint16_t val);
 //
 void LCD_print_hex32(uint32_t val);
 //
-// Helper function to avoid the use of the math library
-//
-// Calculate powers of 10
-//
-int static pow10(uint8_t exp);
-//
 // Display 3 digit unsigned Decimal
 //
 // supports 8 bit unsigned values
@@ -308,6 +410,7 @@ void LCD_print_udec10(uint32_t val);
 // Display 3 digit signed Decimal
 //
 // supports 8 bit signed values
+// Negative values are preceded by '-' (-128 included)
 //
 void LCD_print_dec3(int8_t val);
 //
@@ -323,17 +426,19 @@ void LCD_print_dec5(int16_t val);
 //
 void LCD_print_dec10(int32_t val);
 //
-// Helper function to avoid the use of the math library
+// Display float in scientific notation
 //
-// Calculate powers of 10 as a float
+// x.xxxxExx - 5 significant digits, rounded
 //
-float static pow10f(int8_t exp);
+void LCD_print_float(float val);
 //
-// Display float in scientific notation
+// Display float in fixed point
 //
-// x.xxxxExx
+// int_width digits, '.', frac digits (int_width + frac at most 9)
+// e.g. speed as xx.x - LCD_print_float_fix(speed, 2, 1)
+// Values that do not fit print as '*'
 //
-void LCD_print_float(float val);
+void LCD_print_float_fix(float val, uint8_t int_width, uint8_t frac);
 
 //
 // Change the contrast of the display
@@ -348,4 +453,56 @@ void LCD_print_float(float val);
 //
 void LCD_contrast(uint8_t val);
 
+///////////   Framebuffer routines   ///////////////////////////
+//
+// The driver keeps a RAM copy of the display DDRAM (the framebuffer).
+// Every data write updates it, so it always matches the display.
+//
+// Framebuffer access
+//
+// Returns the 504 byte framebuffer - bank major, index = bank * 84 + column
+// LSB is the top pixel of the bank
+// Wait for LCD_flush_busy() to return 0 before changing it and
+// mark the changes with LCD_fb_dirty
+//
+uint8_t *LCD_framebuffer(void);
+//
+// Flush the framebuffer
+//
+// Sends the columns of each bank that changed since the last flush
+// (address commands + DMA for the data) and returns without
+// waiting - the CPU is free (or can sleep) during the transfer
+// Queued messages are sent first; messages queued during the flush follow it
+// Calling LCD_flush while a flush runs repeats the flush once it completes
+//
+void LCD_flush(void);
+//
+// Mark part of the framebuffer dirty
+//
+// Use after changing the framebuffer through LCD_framebuffer()
+// bank 0-5, columns col_lo to col_hi (0-83)
+//
+void LCD_fb_dirty(uint8_t bank, uint8_t col_lo, uint8_t col_hi);
+//
+// Buffered mode
+//
+// 1 - drawing routines only change the framebuffer, LCD_flush sends the changes
+// 0 - drawing routines write the display directly (default)
+//
+void LCD_buffered(uint8_t on);
+//
+// Flush status
+//
+// Returns 1 while a flush is in progress, 0 when complete
+//
+uint8_t LCD_flush_busy(void);
+//
+// Flush completion callback
+//
+// callback runs in interrupt context (DMA_INT1) when a flush completes
+// (from LCD_flush itself when there is nothing to send)
+// Pass 0 to remove the callback
+//
+void LCD_flush_callback(void (*callback)(void));
+
 #endif //__MSOE_LIB_LCD_H__
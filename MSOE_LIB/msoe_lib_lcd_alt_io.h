@@ -14,6 +14,8 @@
  *      Rev:    1.0     1/21/18     new file to change UARTs for students with bad pins
  *                                      uses UART2 - widder
 *       Rev:    1.1     7/23/18     name change
+ *      Rev:    1.2     10/17/26    msoe_lib_lcd_alt_io.c builds msoe_lib_lcd.c with
+ *                                      LCD_ALT_IO - function prototypes are in msoe_lib_lcd.h
  *
  */
 
@@ -84,6 +86,8 @@
 // Nokia 5110 LCD Module / MSP432 Hardware Configuration (pinout)
 //        ***  Alternate UART  ***
 //
+// eUSCI_A1 SPI, DMA channel 2
+//
 // VCC                      pin 1   3.3V
 // GND                      pin 2   GND
 // SCE (Slave Select)       pin 3   P2.0    output
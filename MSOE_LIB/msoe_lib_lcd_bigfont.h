@@ -0,0 +1,115 @@
+/*
+ * msoe_lib_lcd_bigfont.h
+ *
+ *  Generated by host/bigfont_gen.c from ASCII_BIG in msoe_lib_lcd_char.h
+ *  - do not edit, rerun the generator instead
+ *
+ */
+#ifndef __MSOE_LIB_LCD_BIGFONT_H__
+#define __MSOE_LIB_LCD_BIGFONT_H__
+
+// Big character strips
+//
+// ASCII_BIG_STRIP[val - 0x20][half] is the 10 column strip for the upper (0)
+// or lower (1) bank of a big character - 1 blank column, the 8 character
+// columns, 1 blank column - ready to copy to the display in one run
+//
+#define ASCII_BIG_FIRST     0x20
+#define ASCII_BIG_LAST      0x7A
+#define ASCII_BIG_COLS      10
+
+static const uint8_t ASCII_BIG_STRIP[][2][ASCII_BIG_COLS] = {
+  {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 20 ' '
+  {{0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00}}, // 21 '!'
+  {{0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0x04, 0x07, 0x03, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 22 '"'
+  {{0x00, 0x10, 0xFE, 0xFE, 0x10, 0x10, 0xFE, 0xFE, 0x10, 0x00}, {0x00, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x00}}, // 23 '#'
+  {{0x00, 0x1C, 0x3E, 0x22, 0xFF, 0xFF, 0x42, 0xCE, 0x8C, 0x00}, {0x00, 0x03, 0x07, 0x04, 0x0F, 0x0F, 0x04, 0x07, 0x03, 0x00}}, // 24 '$'
+  {{0x00, 0x00, 0x00, 0x06, 0xC6, 0xF0, 0x3C, 0x0E, 0x02, 0x00}, {0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0x06, 0x06, 0x00, 0x00}}, // 25 '%'
+  {{0x00, 0x1E, 0x3F, 0xE1, 0xC1, 0x41, 0x21, 0x3F, 0x1E, 0x00}, {0x00, 0x06, 0x0F, 0x09, 0x09, 0x0B, 0x0C, 0x1E, 0x16, 0x00}}, // 26 '&'
+  {{0x00, 0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 27 '''
+  {{0x00, 0x00, 0x00, 0xF8, 0xFE, 0x07, 0x01, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x08, 0x00, 0x00, 0x00}}, // 28 '('
+  {{0x00, 0x00, 0x00, 0x01, 0x07, 0xFE, 0xF8, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x08, 0x0E, 0x07, 0x01, 0x00, 0x00, 0x00}}, // 29 ')'
+  {{0x00, 0x20, 0xA8, 0xF8, 0x70, 0x70, 0xF8, 0xA8, 0x20, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 2A '*'
+  {{0x00, 0x20, 0x20, 0x20, 0xFC, 0xFC, 0x20, 0x20, 0x20, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00}}, // 2B '+'
+  {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x20, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x00}}, // 2C ','
+  {{0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 2D '-'
+  {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00}}, // 2E '.'
+  {{0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x00}, {0x00, 0x00, 0x0C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 2F '/'
+  {{0x00, 0xFE, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFE, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 30 '0'
+  {{0x00, 0x00, 0x04, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x00, 0x00}}, // 31 '1'
+  {{0x00, 0x02, 0x03, 0x81, 0xC1, 0x61, 0x31, 0x1F, 0x0E, 0x00}, {0x00, 0x0E, 0x0F, 0x09, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x00}}, // 32 '2'
+  {{0x00, 0x02, 0x03, 0x01, 0x21, 0x21, 0x21, 0xFF, 0xDE, 0x00}, {0x00, 0x04, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 33 '3'
+  {{0x00, 0xE0, 0xF0, 0x98, 0x8C, 0x86, 0xFF, 0xFF, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00}}, // 34 '4'
+  {{0x00, 0x3F, 0x3F, 0x21, 0x21, 0x21, 0x21, 0xE1, 0xC1, 0x00}, {0x00, 0x04, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 35 '5'
+  {{0x00, 0xFC, 0xFE, 0x23, 0x21, 0x21, 0x21, 0xE0, 0xC0, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 36 '6'
+  {{0x00, 0x03, 0x03, 0x01, 0x81, 0xE1, 0x79, 0x1F, 0x07, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00}}, // 37 '7'
+  {{0x00, 0xDE, 0xFF, 0x21, 0x21, 0x21, 0x21, 0xFF, 0xDE, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 38 '8'
+  {{0x00, 0x1E, 0x3F, 0x21, 0x21, 0x21, 0x21, 0xFF, 0xFE, 0x00}, {0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x07, 0x03, 0x00}}, // 39 '9'
+  {{0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00}}, // 3A ':'
+  {{0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x10, 0x1E, 0x0E, 0x00, 0x00, 0x00, 0x00}}, // 3B ';'
+  {{0x00, 0x40, 0xE0, 0xB0, 0x18, 0x0C, 0x06, 0x02, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0C, 0x08, 0x00, 0x00}}, // 3C '<'
+  {{0x00, 0x00, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 3D '='
+  {{0x00, 0x00, 0x02, 0x06, 0x0C, 0x18, 0xB0, 0xE0, 0x40, 0x00}, {0x00, 0x00, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00}}, // 3E '>'
+  {{0x00, 0x02, 0x03, 0x01, 0xC1, 0xE1, 0x31, 0x1F, 0x0E, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00}}, // 3F '?'
+  {{0x00, 0x02, 0x03, 0x01, 0xC1, 0xE1, 0x31, 0x1F, 0x0E, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00}}, // 40 '@'
+  {{0x00, 0xF8, 0xFC, 0x86, 0x83, 0x83, 0x86, 0xFC, 0xF8, 0x00}, {0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 41 'A'
+  {{0x00, 0xFF, 0xFF, 0x21, 0x21, 0x21, 0x21, 0xFF, 0xDE, 0x00}, {0x00, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 42 'B'
+  {{0x00, 0xFC, 0xFE, 0x03, 0x01, 0x01, 0x01, 0x03, 0x06, 0x00}, {0x00, 0x03, 0x07, 0x0C, 0x08, 0x08, 0x08, 0x0C, 0x06, 0x00}}, // 43 'C'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x01, 0x01, 0x03, 0xFE, 0xFC, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x0C, 0x07, 0x03, 0x00}}, // 44 'D'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x21, 0x21, 0x71, 0x03, 0x03, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x00}}, // 45 'E'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x21, 0x21, 0x71, 0x03, 0x03, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 46 'F'
+  {{0x00, 0xFC, 0xFE, 0x03, 0x01, 0x41, 0x41, 0xC3, 0xC6, 0x00}, {0x00, 0x03, 0x07, 0x0C, 0x08, 0x08, 0x08, 0x07, 0x0F, 0x00}}, // 47 'G'
+  {{0x00, 0xFF, 0xFF, 0x20, 0x20, 0x20, 0x20, 0xFF, 0xFF, 0x00}, {0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 48 'H'
+  {{0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x00}, {0x00, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x00, 0x00}}, // 49 'I'
+  {{0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00}, {0x00, 0x06, 0x0E, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00, 0x00}}, // 4A 'J'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x70, 0xD8, 0x8C, 0x07, 0x03, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x00, 0x00, 0x01, 0x0F, 0x0E, 0x00}}, // 4B 'K'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x00}}, // 4C 'L'
+  {{0x00, 0xFF, 0xFF, 0x0C, 0x78, 0x78, 0x0C, 0xFF, 0xFF, 0x00}, {0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 4D 'M'
+  {{0x00, 0xFF, 0xFF, 0x1C, 0x38, 0x70, 0xE0, 0xFF, 0xFF, 0x00}, {0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 4E 'N'
+  {{0x00, 0xFE, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFE, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 4F 'O'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x21, 0x21, 0x21, 0x3F, 0x1E, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 50 'P'
+  {{0x00, 0xFE, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFE, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x0E, 0x1C, 0x38, 0x2F, 0x07, 0x00}}, // 51 'Q'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x21, 0x21, 0x61, 0xFF, 0x9E, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 52 'R'
+  {{0x00, 0x0E, 0x1F, 0x31, 0x21, 0x21, 0x61, 0xC7, 0x86, 0x00}, {0x00, 0x06, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 53 'S'
+  {{0x00, 0x03, 0x03, 0x01, 0xFF, 0xFF, 0x01, 0x03, 0x03, 0x00}, {0x00, 0x00, 0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x00}}, // 54 'T'
+  {{0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 55 'U'
+  {{0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00}, {0x00, 0x01, 0x03, 0x06, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x00}}, // 56 'V'
+  {{0x00, 0xFF, 0xFF, 0x00, 0xE0, 0xE0, 0x00, 0xFF, 0xFF, 0x00}, {0x00, 0x01, 0x0F, 0x0E, 0x03, 0x03, 0x0E, 0x0F, 0x01, 0x00}}, // 57 'W'
+  {{0x00, 0x07, 0x0F, 0x98, 0xF0, 0xF0, 0x98, 0x0F, 0x07, 0x00}, {0x00, 0x0E, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x0F, 0x0E, 0x00}}, // 58 'X'
+  {{0x00, 0x0F, 0x1F, 0x30, 0xE0, 0xE0, 0x30, 0x1F, 0x0F, 0x00}, {0x00, 0x00, 0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x00}}, // 59 'Y'
+  {{0x00, 0x03, 0x83, 0xC1, 0x61, 0x31, 0x19, 0x0F, 0x07, 0x00}, {0x00, 0x0F, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x00}}, // 5A 'Z'
+  {{0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x0F, 0x0F, 0x08, 0x08, 0x00, 0x00, 0x00}}, // 5B '['
+  {{0x00, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x00}, {0x00, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x00}}, // 5C '\'
+  {{0x00, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x00, 0x00, 0x00}}, // 5D ']'
+  {{0x00, 0x08, 0x0C, 0x06, 0x03, 0x03, 0x06, 0x0C, 0x08, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 5E '^'
+  {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00}}, // 5F '_'
+  {{0x00, 0x00, 0x00, 0x08, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 60 '`'
+  {{0x00, 0x00, 0x90, 0x90, 0x90, 0x90, 0xF0, 0xE0, 0x00, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x07, 0x0F, 0x08, 0x00}}, // 61 'a'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x10, 0x10, 0x30, 0xE0, 0xC0, 0x00}, {0x00, 0x08, 0x0F, 0x07, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 62 'b'
+  {{0x00, 0xE0, 0xF0, 0x10, 0x10, 0x10, 0x10, 0x30, 0x20, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x04, 0x00}}, // 63 'c'
+  {{0x00, 0xC0, 0xE0, 0x30, 0x10, 0x11, 0xFF, 0xFF, 0x00, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x07, 0x0F, 0x08, 0x00}}, // 64 'd'
+  {{0x00, 0xE0, 0xF0, 0x90, 0x90, 0x90, 0x90, 0xF0, 0xE0, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x04, 0x00}}, // 65 'e'
+  {{0x00, 0x00, 0x10, 0xFE, 0xFF, 0x11, 0x11, 0x03, 0x02, 0x00}, {0x00, 0x00, 0x08, 0x0F, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00}}, // 66 'f'
+  {{0x00, 0xE0, 0xF0, 0x10, 0x10, 0x10, 0xE0, 0xF0, 0x10, 0x00}, {0x00, 0x27, 0x6F, 0x48, 0x48, 0x48, 0x7F, 0x3F, 0x00, 0x00}}, // 67 'g'
+  {{0x00, 0x01, 0xFF, 0xFF, 0x20, 0x10, 0x10, 0xF0, 0xE0, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 68 'h'
+  {{0x00, 0x00, 0x10, 0x10, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x00, 0x00}}, // 69 'i'
+  {{0x00, 0x00, 0x00, 0x10, 0x10, 0xF6, 0xF6, 0x00, 0x00, 0x00}, {0x00, 0x30, 0x60, 0x40, 0x40, 0x7F, 0x3F, 0x00, 0x00, 0x00}}, // 6A 'j'
+  {{0x00, 0x01, 0xFF, 0xFF, 0xC0, 0xC0, 0x60, 0x30, 0x10, 0x00}, {0x00, 0x08, 0x0F, 0x0F, 0x00, 0x01, 0x03, 0x0E, 0x0C, 0x00}}, // 6B 'k'
+  {{0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x08, 0x08, 0x00, 0x00}}, // 6C 'l'
+  {{0x00, 0xF0, 0xF0, 0x30, 0xE0, 0xE0, 0x30, 0xF0, 0xE0, 0x00}, {0x00, 0x0F, 0x0F, 0x00, 0x07, 0x07, 0x00, 0x0F, 0x0F, 0x00}}, // 6D 'm'
+  {{0x00, 0x10, 0xF0, 0xE0, 0x10, 0x10, 0x10, 0xF0, 0xE0, 0x00}, {0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00}}, // 6E 'n'
+  {{0x00, 0xE0, 0xF0, 0x10, 0x10, 0x10, 0x10, 0xF0, 0xE0, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 6F 'o'
+  {{0x00, 0x10, 0xF0, 0xE0, 0x10, 0x10, 0x10, 0xF0, 0xE0, 0x00}, {0x00, 0x40, 0x7F, 0x7F, 0x48, 0x08, 0x08, 0x0F, 0x07, 0x00}}, // 70 'p'
+  {{0x00, 0xE0, 0xF0, 0x10, 0x10, 0x10, 0xE0, 0xF0, 0x10, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x48, 0x7F, 0x7F, 0x40, 0x00}}, // 71 'q'
+  {{0x00, 0x10, 0xF0, 0xE0, 0x10, 0x10, 0x10, 0x30, 0x20, 0x00}, {0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}, // 72 'r'
+  {{0x00, 0x60, 0xF0, 0x90, 0x90, 0x90, 0x10, 0x30, 0x20, 0x00}, {0x00, 0x04, 0x0C, 0x08, 0x08, 0x09, 0x09, 0x0F, 0x06, 0x00}}, // 73 's'
+  {{0x00, 0x10, 0x10, 0xFE, 0xFF, 0x10, 0x10, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x07, 0x0F, 0x08, 0x0C, 0x04, 0x00, 0x00}}, // 74 't'
+  {{0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00}, {0x00, 0x07, 0x0F, 0x08, 0x08, 0x08, 0x07, 0x0F, 0x08, 0x00}}, // 75 'u'
+  {{0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00}, {0x00, 0x01, 0x03, 0x06, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x00}}, // 76 'v'
+  {{0x00, 0xF0, 0xF0, 0x00, 0x80, 0x80, 0x00, 0xF0, 0xF0, 0x00}, {0x00, 0x07, 0x0F, 0x0C, 0x07, 0x07, 0x0C, 0x0F, 0x07, 0x00}}, // 77 'w'
+  {{0x00, 0x10, 0x30, 0x60, 0xC0, 0xC0, 0x60, 0x30, 0x10, 0x00}, {0x00, 0x08, 0x0C, 0x06, 0x03, 0x03, 0x06, 0x0C, 0x08, 0x00}}, // 78 'x'
+  {{0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00}, {0x00, 0x47, 0x4F, 0x48, 0x48, 0x48, 0x68, 0x3F, 0x1F, 0x00}}, // 79 'y'
+  {{0x00, 0x30, 0x30, 0x10, 0x90, 0xD0, 0x70, 0x30, 0x10, 0x00}, {0x00, 0x0C, 0x0E, 0x0B, 0x09, 0x08, 0x08, 0x0C, 0x0C, 0x00}}  // 7A 'z'
+};
+
+#endif // __MSOE_LIB_LCD_BIGFONT_H__
@@ -0,0 +1,245 @@
+/*
+ * msoe_lib_prof.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     cycle counter profiling - named sections, statistics
+ *
+ */
+#ifndef __MSOE_LIB_PROF_C__
+#define __MSOE_LIB_PROF_C__
+////////////////////////////////////////////
+//
+// Profiling Routines - see msoe_lib_prof.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include <string.h>
+#include "msp432.h"
+#include "msoe_lib_fmt.h"
+#include "msoe_lib_prof.h"
+
+#define PROF_TRCENA         0x01000000UL        // CoreDebug DEMCR - enable DWT
+#define PROF_CYCCNTENA      0x00000001UL        // DWT CTRL - run CYCCNT
+#define PROF_NAME_WIDTH     10                  // name column of the wide table
+
+static Prof_stats_t Prof_table[PROF_MAX];
+static uint8_t Prof_used = 0;
+static uint32_t Prof_overhead = 0;              // clocks of an empty section
+
+//
+// Local routines
+//
+uint8_t static Prof_bin(uint32_t clocks);
+uint8_t static Prof_name(char *buf, const char *name, uint8_t width);
+uint8_t static Prof_digits(uint32_t val);
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// The overhead is the smallest of a few back to back begin / end reads
+//
+void Prof_Init(void){
+    uint32_t start;
+    uint32_t clocks;
+    uint8_t i;
+
+    CoreDebug->DEMCR |= PROF_TRCENA;
+    DWT->CTRL |= PROF_CYCCNTENA;
+
+    Prof_used = 0;
+    memset(Prof_table, 0, sizeof(Prof_table));
+
+    Prof_overhead = 0xFFFFFFFF;
+    for(i = 0; i < 8; i++){
+        start = Prof_begin();
+        clocks = Prof_begin() - start;
+        if(clocks < Prof_overhead)
+            Prof_overhead = clocks;
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_section
+//
+////////////////////////////////////////////////////////////////////
+int8_t Prof_section(const char *name){
+    uint8_t i;
+
+    for(i = 0; i < Prof_used; i++)
+        if(strcmp(Prof_table[i].name, name) == 0)
+            return (int8_t)i;
+    if(Prof_used >= PROF_MAX)
+        return -1;
+    memset(&Prof_table[Prof_used], 0, sizeof(Prof_stats_t));
+    Prof_table[Prof_used].name = name;
+    return (int8_t)Prof_used++;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_begin / Prof_end
+//
+////////////////////////////////////////////////////////////////////
+uint32_t Prof_begin(void){
+    return DWT->CYCCNT;
+}
+
+//
+// Unsigned difference - correct across one CYCCNT wrap
+// The update is short and done with interrupts off so an interrupt that
+// ends a section of its own cannot tear it
+//
+void Prof_end(int8_t id, uint32_t start){
+    uint32_t clocks = DWT->CYCCNT - start;
+    uint32_t int_state;
+    Prof_stats_t *s;
+
+    if(id < 0 || id >= Prof_used)
+        return;
+    clocks = (clocks > Prof_overhead) ? clocks - Prof_overhead : 0;
+    s = &Prof_table[id];
+
+    int_state = _disable_interrupts();
+    if(s->count == 0 || clocks < s->min)
+        s->min = clocks;
+    if(clocks > s->max)
+        s->max = clocks;
+    s->count++;
+    s->total += clocks;
+    s->hist[Prof_bin(clocks)]++;
+    _restore_interrupts(int_state);
+}
+
+//
+// Histogram bin - log base 4 of the clocks, by halving the search
+//
+uint8_t static Prof_bin(uint32_t clocks){
+    uint8_t bin = 0;
+
+    if(clocks >= (1UL << 16)){ clocks >>= 16; bin += 8; }
+    if(clocks >= (1UL << 8)){ clocks >>= 8; bin += 4; }
+    if(clocks >= (1UL << 4)){ clocks >>= 4; bin += 2; }
+    if(clocks >= (1UL << 2)){ bin += 1; }
+    return bin;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_get / Prof_clear
+//
+////////////////////////////////////////////////////////////////////
+void Prof_get(int8_t id, Prof_stats_t *stats){
+    uint32_t int_state;
+
+    if(id < 0 || id >= Prof_used){
+        memset(stats, 0, sizeof(Prof_stats_t));
+        return;
+    }
+    int_state = _disable_interrupts();
+    *stats = Prof_table[id];
+    _restore_interrupts(int_state);
+}
+
+void Prof_clear(void){
+    uint32_t int_state;
+    const char *name;
+    uint8_t i;
+
+    for(i = 0; i < Prof_used; i++){
+        int_state = _disable_interrupts();
+        name = Prof_table[i].name;
+        memset(&Prof_table[i], 0, sizeof(Prof_stats_t));
+        Prof_table[i].name = name;
+        _restore_interrupts(int_state);
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_dump
+//
+////////////////////////////////////////////////////////////////////
+//
+// Name padded with spaces (or cut) to width characters
+// Returns width
+//
+uint8_t static Prof_name(char *buf, const char *name, uint8_t width){
+    uint8_t i;
+
+    for(i = 0; i < width && name[i] != 0; i++)
+        buf[i] = name[i];
+    for(; i < width; i++)
+        buf[i] = ' ';
+    buf[width] = 0;
+    return width;
+}
+
+//
+// Decimal digits in val (1 for 0)
+//
+uint8_t static Prof_digits(uint32_t val){
+    uint8_t n = 1;
+
+    while(val > 9 && n < 10){
+        val /= 10;
+        n++;
+    }
+    return n;
+}
+
+void Prof_dump(void (*out)(const char *line), uint8_t narrow){
+    char line[PROF_LINE];
+    Prof_stats_t s;
+    uint32_t mean;
+    uint8_t last;
+    uint8_t n;
+    uint8_t i;
+    uint8_t b;
+
+    if(!narrow)
+        out("section        count       min       max      mean");
+
+    for(i = 0; i < Prof_used; i++){
+        Prof_get((int8_t)i, &s);
+        mean = s.count ? (uint32_t)(s.total / s.count) : 0;
+
+        if(narrow){
+            Prof_name(line, s.name, 14);
+            out(line);
+            Fmt_udec(line, (mean > 999999) ? 999999 : mean, 6);
+            line[6] = ' ';
+            Fmt_udec(&line[7], (s.max > 9999999) ? 9999999 : s.max, 7);
+            out(line);
+            continue;
+        }
+
+        n = Prof_name(line, s.name, PROF_NAME_WIDTH);
+        n += Fmt_udec(&line[n], s.count, 10);
+        n += Fmt_udec(&line[n], s.min, 10);
+        n += Fmt_udec(&line[n], s.max, 10);
+        Fmt_udec(&line[n], mean, 10);
+        out(line);
+
+        last = 0;
+        for(b = 0; b < PROF_BINS; b++)
+            if(s.hist[b])
+                last = b;
+        memcpy(line, "  hist", 6);
+        n = 6;
+        for(b = 0; b <= last; b++){
+            line[n++] = ' ';
+            n += Fmt_udec(&line[n], s.hist[b], Prof_digits(s.hist[b]));
+        }
+        line[n] = 0;
+        out(line);
+    }
+}
+
+#endif // __MSOE_LIB_PROF_C__
@@ -0,0 +1,165 @@
+/*
+ * msoe_lib_prof.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     cycle counter profiling - named sections, statistics
+ *
+ */
+#ifndef __MSOE_LIB_PROF_H__
+#define __MSOE_LIB_PROF_H__
+////////////////////////////////////////////
+//
+// Profiling Routines
+//
+// Measures how long a piece of code takes in CPU clocks using the
+// Cortex-M4 DWT cycle counter (DWT->CYCCNT) - no pin toggling or scope
+// Each named section keeps count, min, max, mean and a histogram
+//
+//      static int8_t prof_port6;
+//      prof_port6 = Prof_section("PORT6 ISR");     // once, at start up
+//
+//      void PORT6_IRQHandler(void){
+//          uint32_t t = Prof_begin();
+//          ...
+//          Prof_end(prof_port6, t);
+//      }
+//
+// or for a block
+//      PROF_SCOPE(prof_lcd){
+//          LCD_print_str(buf);
+//      }
+//
+// Sections may nest and may be used in interrupts
+// The cost of the begin / end calls is measured by Prof_Init and taken off
+// every measurement - an empty section reads (about) 0
+// At 48MHz CYCCNT wraps every ~89s - a section must be shorter than that
+//
+// Host builds (host/msp432.h) read CYCCNT from clock_gettime in ns so the
+// same instrumentation runs in unit tests
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Number of sections
+//
+#if !defined(PROF_MAX)
+#define PROF_MAX            16
+#endif
+
+//
+// Histogram - bin n counts sections of 4^n to 4^(n+1) - 1 clocks
+// (bin 0 - 0 to 3 clocks, bin 15 - 2^30 clocks and longer)
+//
+#define PROF_BINS           16
+
+//
+// Longest line Prof_dump sends (including the terminating 0)
+//
+#define PROF_LINE           200
+
+typedef struct {
+    const char *name;
+    uint32_t count;                 // measurements
+    uint32_t min;                   // clocks
+    uint32_t max;
+    uint64_t total;                 // mean = total / count
+    uint32_t hist[PROF_BINS];
+} Prof_stats_t;
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Starts the DWT cycle counter, clears all sections and measures the
+// begin / end overhead
+//
+// Inputs: none
+// Outputs: none
+//
+void Prof_Init(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_section
+//
+////////////////////////////////////////////////////////////////////
+//
+// Registers a named section - a name already registered returns its id
+// The name is kept by pointer (use a string literal)
+// Call at start up, not in the code being measured
+//
+// Inputs: section name
+// Outputs: section id (0 to PROF_MAX - 1), -1 if all sections are used
+//
+int8_t Prof_section(const char *name);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_begin / Prof_end / PROF_SCOPE
+//
+////////////////////////////////////////////////////////////////////
+//
+// Prof_begin returns the cycle count at the start of the section, Prof_end
+// adds the clocks since then to the section statistics
+// PROF_SCOPE(id) { ... } does both around a block - leave the block at the
+// bottom (a break, goto or return skips the measurement)
+//
+// Inputs: section id, start count from Prof_begin
+// Outputs: cycle count (Prof_begin)
+//
+uint32_t Prof_begin(void);
+void Prof_end(int8_t id, uint32_t start);
+
+#define PROF_SCOPE(id)                                                      \
+    for(uint32_t prof_start_ = Prof_begin(), prof_once_ = 1; prof_once_;    \
+        prof_once_ = 0, Prof_end((id), prof_start_))
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_get / Prof_clear
+//
+////////////////////////////////////////////////////////////////////
+//
+// Prof_get copies the statistics of a section (all 0 for a bad id)
+// Prof_clear zeroes the statistics of every section, the names stay
+//
+// Inputs: section id, pointer to the stats to fill in
+// Outputs: none
+//
+void Prof_get(int8_t id, Prof_stats_t *stats);
+void Prof_clear(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Prof_dump
+//
+////////////////////////////////////////////////////////////////////
+//
+// Sends the table one line at a time (no line ending) to out - e.g. a
+// UART send that adds "\r\n", or a routine that puts each line on an
+// LCD row
+//
+// wide (UART / console) - header, then per section
+//      name        count       min       max      mean
+//        hist  bin 0 count ... up to the last non-empty bin
+// narrow (14 character LCD rows) - per section
+//      name
+//      mean max (clocks, 6 and 7 digits, 999999 / 9999999 when larger)
+//
+// Inputs: line output routine, narrow (1) or wide (0)
+// Outputs: none
+//
+void Prof_dump(void (*out)(const char *line), uint8_t narrow);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_PROF_H__
@@ -0,0 +1,154 @@
+/*
+ * msoe_lib_pt.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     stackless coroutines (protothreads)
+ *
+ */
+#ifndef __MSOE_LIB_PT_H__
+#define __MSOE_LIB_PT_H__
+////////////////////////////////////////////
+//
+// Coroutine Macros
+//
+// A hardware sequence written as straight line code that returns to its
+// caller wherever it would otherwise spin on a status bit - the next call
+// continues from that point. Several sequences called in turn from one loop
+// make progress together
+//
+//      uint8_t Thing_Init_pt(Pt_t *pt){
+//          PT_BEGIN(pt);
+//          REG->CTL = START;
+//          PT_WAIT_UNTIL(pt, REG->STAT & READY);   // returns PT_WAITING until ready
+//          REG->CTL = RUN;
+//          PT_END(pt);                             // returns PT_ENDED
+//      }
+//
+//      Pt_t a, b;
+//      PT_INIT(&a);
+//      PT_INIT(&b);
+//      while(PT_SCHEDULE(Thing_Init_pt(&a)) | PT_SCHEDULE(Other_Init_pt(&b)))
+//          ;
+//
+// Only the resume point is kept (2 bytes) - there is no stack
+//      local variables do not survive a wait or yield - keep them static
+//      no switch statement in a coroutine (the macros are one)
+//      one wait or yield per source line (the line number is the resume point)
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+typedef struct {
+    uint16_t lc;                    // resume point - source line, 0 at the start
+} Pt_t;
+
+//
+// Coroutine return values
+//
+#define PT_WAITING          0       // blocked on a condition
+#define PT_YIELDED          1       // gave up the CPU, can continue
+#define PT_EXITED           2       // stopped early (PT_EXIT)
+#define PT_ENDED            3       // ran to PT_END
+
+////////////////////////////////////////////////////////////////////
+//
+// PT_INIT / PT_BEGIN / PT_END
+//
+////////////////////////////////////////////////////////////////////
+//
+// PT_INIT - start (or restart) a coroutine from the top
+// PT_BEGIN - first statement of a coroutine
+// PT_END - last statement - restarts the coroutine and returns PT_ENDED
+//
+#define PT_INIT(pt)         ((pt)->lc = 0)
+
+#define PT_BEGIN(pt)                                                        \
+    {                                                                       \
+        uint8_t PT_yielded = 1;                                             \
+        (void)PT_yielded;                                                   \
+        switch((pt)->lc){                                                   \
+        case 0:
+
+#define PT_END(pt)                                                          \
+        }                                                                   \
+        PT_INIT(pt);                                                        \
+        return PT_ENDED;                                                    \
+    }
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// PT_WAIT_UNTIL / PT_WAIT_WHILE / PT_YIELD / PT_EXIT
+//
+////////////////////////////////////////////////////////////////////
+//
+// PT_WAIT_UNTIL - return PT_WAITING until the condition is true
+//      the condition is checked first - no return if it is already true
+// PT_WAIT_WHILE - return PT_WAITING while the condition is true
+// PT_YIELD - return PT_YIELDED once, continue on the next call
+// PT_EXIT - stop - restarts the coroutine and returns PT_EXITED
+//
+#define PT_SET(pt)          (pt)->lc = __LINE__; case __LINE__:
+
+#define PT_WAIT_UNTIL(pt, cond)                                             \
+    do{                                                                     \
+        PT_SET(pt)                                                          \
+        if(!(cond))                                                         \
+            return PT_WAITING;                                              \
+    } while(0)
+
+#define PT_WAIT_WHILE(pt, cond)     PT_WAIT_UNTIL(pt, !(cond))
+
+#define PT_YIELD(pt)                                                        \
+    do{                                                                     \
+        PT_yielded = 0;                                                     \
+        PT_SET(pt)                                                          \
+        if(PT_yielded == 0)                                                 \
+            return PT_YIELDED;                                              \
+    } while(0)
+
+#define PT_EXIT(pt)                                                         \
+    do{                                                                     \
+        PT_INIT(pt);                                                        \
+        return PT_EXITED;                                                   \
+    } while(0)
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// PT_WAIT_LIMIT
+//
+////////////////////////////////////////////////////////////////////
+//
+// PT_WAIT_UNTIL with a limit on the number of checks - count (a static
+// or a member, not a local) is decremented on each failed check and the
+// wait ends when it reaches 0. Test count afterwards - 0 is a timeout
+//      PT_WAIT_LIMIT(pt, !(PCM->CTL1 & BUSY), pmr_fail);
+//      if(pmr_fail == 0) ...
+//
+#define PT_WAIT_LIMIT(pt, cond, count)                                      \
+    PT_WAIT_UNTIL(pt, (cond) || --(count) == 0)
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// PT_SCHEDULE / PT_SPAWN
+//
+////////////////////////////////////////////////////////////////////
+//
+// PT_SCHEDULE - 1 while the coroutine call (its return value) is still running
+// PT_SPAWN - start a child coroutine and wait for it to finish
+//
+#define PT_SCHEDULE(f)      ((f) < PT_EXITED)
+
+#define PT_SPAWN(pt, child, thread)                                         \
+    do{                                                                     \
+        PT_INIT(child);                                                     \
+        PT_WAIT_WHILE(pt, PT_SCHEDULE(thread));                             \
+    } while(0)
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_PT_H__
@@ -0,0 +1,211 @@
+/*
+ * msoe_lib_sched.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     run to completion scheduler with SPSC event queues
+ *      Rev:    0.2     time asleep (Sched_clock, Sched_sleep_us) for load measurement
+ *      Rev:    0.3     volatile event buffer - slots not moved past head/tail
+ *
+ */
+#ifndef __MSOE_LIB_SCHED_C__
+#define __MSOE_LIB_SCHED_C__
+////////////////////////////////////////////
+//
+// Scheduler Routines - see msoe_lib_sched.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include <string.h>
+#include "msp432.h"
+#include "msoe_lib_sched.h"
+
+//
+// Queue indexes run free (mod 256) - the producer only writes head, the
+// consumer only writes tail, each a single byte store
+// Buffer index is the low bits (size is a power of 2)
+// The buffer is volatile too - otherwise the compiler may move the slot
+// store after the head store (or the slot load before the head load)
+//
+typedef struct {
+    void (*fn)(uint32_t event);
+    volatile uint32_t *buf;
+    volatile uint8_t head;              // next event written - producer
+    volatile uint8_t tail;              // next event read - consumer
+    uint8_t mask;
+    uint8_t prio;
+    Sched_stats_t stats;
+} Sched_task_t;
+
+//
+// Tasks in priority order - Sched_order[0] is checked first
+//
+static Sched_task_t Sched_tasks[SCHED_MAX];
+static uint8_t Sched_order[SCHED_MAX];
+static uint8_t Sched_count = 0;
+static uint32_t Sched_sleeps = 0;
+static uint32_t (*Sched_now)(void) = 0;     // us clock for the time asleep
+static volatile uint32_t Sched_slept = 0;   // us asleep
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_Init
+//
+////////////////////////////////////////////////////////////////////
+void Sched_Init(void){
+    Sched_count = 0;
+    Sched_sleeps = 0;
+    Sched_slept = 0;
+    memset(Sched_tasks, 0, sizeof(Sched_tasks));
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_task
+//
+////////////////////////////////////////////////////////////////////
+//
+// Insert into the priority order after any task of the same priority
+//
+int8_t Sched_task(void (*fn)(uint32_t event), uint8_t prio, volatile uint32_t *buf, uint8_t size){
+    Sched_task_t *t;
+    uint8_t i;
+
+    if(Sched_count >= SCHED_MAX || fn == 0 || buf == 0
+       || size < 2 || size > 128 || (size & (size - 1)))
+        return -1;
+
+    t = &Sched_tasks[Sched_count];
+    memset(t, 0, sizeof(Sched_task_t));
+    t->fn = fn;
+    t->buf = buf;
+    t->mask = size - 1;
+    t->prio = prio;
+
+    for(i = Sched_count; i > 0 && Sched_tasks[Sched_order[i - 1]].prio > prio; i--)
+        Sched_order[i] = Sched_order[i - 1];
+    Sched_order[i] = Sched_count;
+    return (int8_t)Sched_count++;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_post
+//
+////////////////////////////////////////////////////////////////////
+//
+// The event is written before head moves on - the consumer never sees a
+// slot it may not read yet
+//
+uint8_t Sched_post(int8_t task, uint32_t event){
+    Sched_task_t *t;
+    uint8_t head;
+    uint8_t used;
+
+    if(task < 0 || task >= Sched_count)
+        return 0;
+    t = &Sched_tasks[task];
+    head = t->head;
+    used = (uint8_t)(head - t->tail);
+    if(used > t->mask){
+        t->stats.drops++;
+        return 0;
+    }
+    t->buf[head & t->mask] = event;
+    t->head = head + 1;
+    if(used + 1 > t->stats.high)
+        t->stats.high = used + 1;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_run_once / Sched_run
+//
+////////////////////////////////////////////////////////////////////
+uint8_t Sched_run_once(void){
+    Sched_task_t *t;
+    uint32_t event;
+    uint8_t tail;
+    uint8_t i;
+
+    for(i = 0; i < Sched_count; i++){
+        t = &Sched_tasks[Sched_order[i]];
+        tail = t->tail;
+        if(t->head != tail){
+            event = t->buf[tail & t->mask];
+            t->tail = tail + 1;             // slot free before the task runs
+            t->stats.runs++;
+            t->fn(event);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+//
+// Interrupts are off between the last check and WFI so an event posted
+// in between is not slept through - a pending interrupt ends WFI even
+// with interrupts off, and runs once they are back on
+// The waking interrupt has not run yet when WFI returns - the time read
+// then is the time asleep, without the handler
+//
+void Sched_run(void){
+    uint8_t i;
+    uint8_t ready;
+    uint32_t start;
+
+    while(1){
+        if(Sched_run_once())
+            continue;
+        __disable_irq();
+        ready = 0;
+        for(i = 0; i < Sched_count; i++)
+            ready |= Sched_tasks[i].head != Sched_tasks[i].tail;
+        if(!ready){
+            Sched_sleeps++;
+            if(Sched_now){
+                start = Sched_now();
+                __WFI();
+                Sched_slept += Sched_now() - start;
+            }
+            else
+                __WFI();
+        }
+        __enable_irq();
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_stats / Sched_idle
+//
+////////////////////////////////////////////////////////////////////
+void Sched_stats(int8_t task, Sched_stats_t *stats){
+    if(task < 0 || task >= Sched_count){
+        memset(stats, 0, sizeof(Sched_stats_t));
+        return;
+    }
+    *stats = Sched_tasks[task].stats;
+}
+
+uint32_t Sched_idle(void){
+    return Sched_sleeps;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_clock / Sched_sleep_us
+//
+////////////////////////////////////////////////////////////////////
+void Sched_clock(uint32_t (*now_us)(void)){
+    Sched_now = now_us;
+}
+
+uint32_t Sched_sleep_us(void){
+    return Sched_slept;
+}
+
+#endif // __MSOE_LIB_SCHED_C__
@@ -0,0 +1,152 @@
+/*
+ * msoe_lib_sched.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     run to completion scheduler with SPSC event queues
+ *      Rev:    0.2     time asleep (Sched_clock, Sched_sleep_us) for load measurement
+ *      Rev:    0.3     volatile event buffer - slots not moved past head/tail
+ *
+ */
+#ifndef __MSOE_LIB_SCHED_H__
+#define __MSOE_LIB_SCHED_H__
+////////////////////////////////////////////
+//
+// Scheduler Routines
+//
+// Keeps interrupt handlers short - a handler posts an event (a 32 bit
+// value) to a task and returns, the main loop runs the task later
+//
+//      static uint32_t speed_q[8];
+//      int8_t speed_task;
+//
+//      void speed_update(uint32_t ticks){ ... float math, display ... }
+//
+//      main:   speed_task = Sched_task(speed_update, 1, speed_q, 8);
+//              Sched_run();                    // never returns
+//      ISR:    Sched_post(speed_task, ticks);
+//
+// Each task has its own event queue - a single producer / single consumer
+// ring, lock free: only one context (one ISR, or the main loop) may post
+// to a given task
+// The task is called once per event, to completion - tasks do not preempt
+// each other. After each event the highest priority task with an event
+// runs next (priority 0 is highest, equal priorities in the order added)
+// With no events the CPU sleeps (WFI) until an interrupt
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Number of tasks
+//
+#if !defined(SCHED_MAX)
+#define SCHED_MAX           8
+#endif
+
+typedef struct {
+    uint32_t runs;                  // events handled
+    uint32_t drops;                 // events lost - queue full
+    uint8_t high;                   // most events waiting at once
+} Sched_stats_t;
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Removes all tasks
+//
+// Inputs: none
+// Outputs: none
+//
+void Sched_Init(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_task
+//
+////////////////////////////////////////////////////////////////////
+//
+// Adds a task - call before events are posted to it
+//
+// Inputs: task routine (called with each event), priority (0 highest),
+//         event buffer, buffer size in events (power of 2, 2 to 128)
+// Outputs: task id, -1 if no task is free or the size is not allowed
+//
+int8_t Sched_task(void (*fn)(uint32_t event), uint8_t prio, volatile uint32_t *buf, uint8_t size);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_post
+//
+////////////////////////////////////////////////////////////////////
+//
+// Queues an event for a task - safe in an interrupt, never waits
+//
+// Inputs: task id, event
+// Outputs: 1 if queued, 0 if the queue was full (event dropped and
+//          counted) or the id is bad
+//
+uint8_t Sched_post(int8_t task, uint32_t event);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_run_once / Sched_run
+//
+////////////////////////////////////////////////////////////////////
+//
+// Sched_run_once - runs the highest priority task with an event, for one
+// event
+// Sched_run - runs tasks for ever, sleeping when there is nothing to do
+//
+// Inputs: none
+// Outputs: 1 if a task ran, 0 if there were no events (Sched_run_once)
+//
+uint8_t Sched_run_once(void);
+void Sched_run(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_stats / Sched_idle
+//
+////////////////////////////////////////////////////////////////////
+//
+// Sched_stats - events handled and dropped for a task (all 0 for a bad id)
+// Sched_idle - times Sched_run has put the CPU to sleep
+//
+// Inputs: task id, pointer to the stats to fill in
+// Outputs: none
+//
+void Sched_stats(int8_t task, Sched_stats_t *stats);
+uint32_t Sched_idle(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Sched_clock / Sched_sleep_us
+//
+////////////////////////////////////////////////////////////////////
+//
+// Sched_clock - a us clock (e.g. Time_now_us) read around each sleep,
+// 0 to stop measuring
+// Sched_sleep_us - total us Sched_run has slept (wraps) - the CPU load
+// over a period is 1 - (change in sleep us) / (period us)
+//
+//      Sched_clock(Time_now_us);
+//
+// Inputs: clock routine / none
+// Outputs: none / us asleep
+//
+void Sched_clock(uint32_t (*now_us)(void));
+uint32_t Sched_sleep_us(void);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_SCHED_H__
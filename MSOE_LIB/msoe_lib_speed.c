@@ -0,0 +1,37 @@
+/*
+ * msoe_lib_speed.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     revolution period to road speed
+ *      Rev:    0.2     tenths of mph in integer math (Speed_mph replaced)
+ *
+ */
+#ifndef __MSOE_LIB_SPEED_C__
+#define __MSOE_LIB_SPEED_C__
+////////////////////////////////////////////
+//
+// Speed Routines - see msoe_lib_speed.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msoe_lib_speed.h"
+
+////////////////////////////////////////////////////////////////////
+//
+// Speed_tenths
+//
+////////////////////////////////////////////////////////////////////
+//
+// Half the period added first rounds the quotient - cannot overflow,
+// period / 2 + SPEED_TENTHS_TICKS < 2^32 while the constant is under 2^31
+//
+uint32_t Speed_tenths(uint32_t period){
+    if(period == 0)
+        return 0;
+    return (SPEED_TENTHS_TICKS + (period >> 1)) / period;
+}
+
+#endif // __MSOE_LIB_SPEED_C__
@@ -0,0 +1,63 @@
+/*
+ * msoe_lib_speed.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     revolution period to road speed
+ *      Rev:    0.2     tenths of mph in integer math (Speed_mph replaced)
+ *
+ */
+#ifndef __MSOE_LIB_SPEED_H__
+#define __MSOE_LIB_SPEED_H__
+////////////////////////////////////////////
+//
+// Speed Routines
+//
+// Converts the time for one wheel revolution (msoe_lib_cap period, in
+// SPEED_TICK_HZ ticks) to road speed in tenths of mph
+//
+//      tenths = 36000 * SPEED_TICK_HZ / (SPEED_REV_PER_MI * period)
+//             = SPEED_TENTHS_TICKS / period
+//
+// The wheel and timer are folded into one constant at compile time - the
+// conversion is a single integer divide (no float, no FPU registers to
+// stack in an interrupt)
+//
+// The wheel is the IR test rig's - 146mm (0.479ft) diameter, 1.047ft
+// circumference, 5042.029 revolutions per mile. Define SPEED_REV_PER_MI
+// (and SPEED_TICK_HZ) before the build for another wheel (or timer)
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+#if !defined(SPEED_TICK_HZ)
+#define SPEED_TICK_HZ       12000000UL
+#endif
+
+#if !defined(SPEED_REV_PER_MI)
+#define SPEED_REV_PER_MI    5042.029
+#endif
+
+//
+// Tenths of mph x period - rounded, must fit 32 bits
+//
+#define SPEED_TENTHS_TICKS  ((uint32_t)(36000.0 * SPEED_TICK_HZ / SPEED_REV_PER_MI + 0.5))
+
+////////////////////////////////////////////////////////////////////
+//
+// Speed_tenths
+//
+////////////////////////////////////////////////////////////////////
+//
+// Rounded to the nearest tenth - within 1 of the float formula
+// 0.1mph is a period of ~7.1s (12MHz), 99.9mph ~7.1ms
+//
+// Inputs: revolution period in SPEED_TICK_HZ ticks
+// Outputs: speed in tenths of mph, 0 for a period of 0
+//
+uint32_t Speed_tenths(uint32_t period);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_SPEED_H__
@@ -0,0 +1,179 @@
+/*
+ * msoe_lib_tach.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     several tachometer channels on one timebase
+ *
+ */
+#ifndef __MSOE_LIB_TACH_C__
+#define __MSOE_LIB_TACH_C__
+////////////////////////////////////////////
+//
+// Tachometer Routines - see msoe_lib_tach.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msp432.h"
+#include "msoe_lib_tach.h"
+#include "msoe_lib_filt.h"
+#include "msoe_lib_time.h"
+
+volatile uint8_t Tach_state[TACH_MAX];
+volatile uint32_t Tach_count[TACH_MAX];
+volatile uint32_t Tach_spurious[TACH_MAX];
+volatile uint32_t Tach_stops[TACH_MAX];
+
+//
+// Channel entries - one array each
+//
+static uint32_t Tach_when[TACH_MAX];            // last edge (us)
+static uint32_t Tach_raw[TACH_MAX];             // last period (us)
+static uint32_t Tach_lock[TACH_MAX];            // lockout (us)
+static uint32_t Tach_timeout[TACH_MAX];         // timeout (us)
+static Filt_t Tach_filt[TACH_MAX];
+
+//
+// Local routines
+//
+void static Tach_stop(uint8_t ch, uint8_t state);
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_Init / Tach_channel
+//
+////////////////////////////////////////////////////////////////////
+int Tach_Init(const Filt_cfg_t *cfg){
+    uint8_t ch;
+
+    for(ch = 0; ch < TACH_MAX; ch++){
+        Tach_state[ch] = TACH_OFF;
+        Tach_count[ch] = 0;
+        Tach_spurious[ch] = 0;
+        Tach_stops[ch] = 0;
+        Tach_raw[ch] = 0;
+        if(Filt_Init(&Tach_filt[ch], cfg))
+            return 1;
+    }
+    return 0;
+}
+
+//
+// Timeouts over 2^31 us cannot be told from an edge just after the time
+// Tach_poll read
+//
+int Tach_channel(uint8_t ch, uint32_t lockout_us, uint32_t timeout_us){
+    uint32_t int_state;
+
+    if(ch >= TACH_MAX || timeout_us == 0 || timeout_us <= lockout_us || timeout_us > 0x7FFFFFFFUL)
+        return 1;
+
+    int_state = _disable_interrupts();
+    Tach_lock[ch] = lockout_us;
+    Tach_timeout[ch] = timeout_us;
+    Tach_stop(ch, TACH_STOPPED);
+    _restore_interrupts(int_state);
+    return 0;
+}
+
+//
+// Period and filter cleared
+//
+void static Tach_stop(uint8_t ch, uint8_t state){
+    Tach_raw[ch] = 0;
+    Filt_reset(&Tach_filt[ch]);
+    Tach_state[ch] = state;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_edge / Tach_edge_at
+//
+////////////////////////////////////////////////////////////////////
+void Tach_edge(uint8_t ch){
+    Tach_edge_at(ch, Time_now_us());
+}
+
+void Tach_edge_at(uint8_t ch, uint32_t now){
+    uint8_t state;
+    uint32_t period;
+
+    if(ch >= TACH_MAX)
+        return;
+    state = Tach_state[ch];
+    if(state == TACH_OFF)
+        return;
+
+    period = now - Tach_when[ch];
+    if(state == TACH_STOPPED || period > Tach_timeout[ch]){
+        if(state != TACH_STOPPED)
+            Tach_stops[ch]++;                   // stopped - Tach_poll has not been round
+        Tach_stop(ch, TACH_STARTED);
+        Tach_when[ch] = now;
+        return;
+    }
+    if(period < Tach_lock[ch]){
+        Tach_spurious[ch]++;
+        return;
+    }
+
+    Tach_when[ch] = now;
+    Tach_raw[ch] = period;
+    Filt_add(&Tach_filt[ch], period);
+    Tach_count[ch]++;
+    Tach_state[ch] = TACH_RUNNING;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_poll
+//
+////////////////////////////////////////////////////////////////////
+//
+// An edge after now was read makes now - Tach_when negative - signed, it
+// is not a timeout
+//
+void Tach_poll(uint32_t now){
+    uint32_t int_state;
+    uint8_t ch;
+
+    for(ch = 0; ch < TACH_MAX; ch++){
+        if(Tach_state[ch] < TACH_STARTED)
+            continue;
+        int_state = _disable_interrupts();
+        if(Tach_state[ch] >= TACH_STARTED && (int32_t)(now - Tach_when[ch]) > (int32_t)Tach_timeout[ch]){
+            Tach_stops[ch]++;
+            Tach_stop(ch, TACH_STOPPED);
+        }
+        _restore_interrupts(int_state);
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_period / Tach_last / Tach_rpm
+//
+////////////////////////////////////////////////////////////////////
+uint32_t Tach_period(uint8_t ch){
+    if(ch >= TACH_MAX || Tach_state[ch] != TACH_RUNNING)
+        return 0;
+    return Tach_filt[ch].out;
+}
+
+uint32_t Tach_last(uint8_t ch){
+    if(ch >= TACH_MAX || Tach_state[ch] != TACH_RUNNING)
+        return 0;
+    return Tach_raw[ch];
+}
+
+uint32_t Tach_rpm(uint8_t ch){
+    uint32_t period = Tach_period(ch);
+
+    if(period == 0)
+        return 0;
+    return (60000000UL + (period >> 1)) / period;
+}
+
+#endif // __MSOE_LIB_TACH_C__
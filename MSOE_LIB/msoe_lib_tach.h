@@ -0,0 +1,146 @@
+/*
+ * msoe_lib_tach.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     several tachometer channels on one timebase
+ *
+ */
+#ifndef __MSOE_LIB_TACH_H__
+#define __MSOE_LIB_TACH_H__
+////////////////////////////////////////////
+//
+// Tachometer Routines
+//
+// Periods and RPM for up to TACH_MAX sensors (wheels, shafts - one edge a
+// revolution) at once. Every channel is timed from the one free running
+// microsecond timebase (msoe_lib_time, TIMER_A2) - no timer per sensor
+//
+// Each channel has its own
+//      last edge time, last period
+//      lockout     - edges closer than this to the last are noise
+//      timeout     - no edge for this long, the channel has stopped
+//      filter      - msoe_lib_filt state, all channels the same settings
+// kept as one array per item (struct of arrays) indexed by channel - an
+// edge reads and writes only its channel's entries
+//
+// The edges come from any interrupt - usually a port interrupt with one
+// pin per channel
+//
+//      Time_Init();
+//      Tach_Init(&filt_cfg);
+//      Tach_channel(0, 5000, 2000000);     // 5ms lockout, 2s timeout
+//      Tach_channel(1, 1000, 500000);
+//
+//      void PORT5_IRQHandler(void){
+//          uint8_t flags = P5->IFG;
+//          P5->IFG &= ~flags;
+//          if(flags & BIT0) Tach_edge(0);
+//          if(flags & BIT1) Tach_edge(1);
+//      }
+//
+//      task:   Tach_poll(Time_now_us());
+//              rpm = Tach_rpm(0);
+//
+// Periods are in us - 32 bit times, differences correct across the wrap
+// (~71 minutes)
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msoe_lib_filt.h"
+
+//
+// Number of channels
+//
+#if !defined(TACH_MAX)
+#define TACH_MAX            4
+#endif
+
+//
+// Channel states
+//
+#define TACH_OFF            0
+#define TACH_STOPPED        1       // waiting for a first edge
+#define TACH_STARTED        2       // one edge - no period yet
+#define TACH_RUNNING        3
+
+extern volatile uint8_t Tach_state[TACH_MAX];
+extern volatile uint32_t Tach_count[TACH_MAX];      // periods measured
+extern volatile uint32_t Tach_spurious[TACH_MAX];   // edges in a lockout
+extern volatile uint32_t Tach_stops[TACH_MAX];      // timeouts
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_Init / Tach_channel
+//
+////////////////////////////////////////////////////////////////////
+//
+// Tach_Init - all channels off, the filter settings for every channel
+// Tach_channel - starts (or restarts) a channel - stopped, the first edge
+// starts it
+//
+// Inputs: filter settings (copied) /
+//         channel, lockout in us (0 none), timeout in us
+// Outputs: 0 for success
+//          1 bad filter settings / bad channel or a timeout of 0 or not
+//            longer than the lockout
+//
+int Tach_Init(const Filt_cfg_t *cfg);
+int Tach_channel(uint8_t ch, uint32_t lockout_us, uint32_t timeout_us);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_edge / Tach_edge_at
+//
+////////////////////////////////////////////////////////////////////
+//
+// One edge on a channel - from its interrupt. Tach_edge reads the time
+// (Time_now_us), Tach_edge_at takes a time read earlier (e.g. the same
+// read for two pins flagged together)
+// An edge after more than the timeout starts the channel again even if
+// Tach_poll has not seen the stop yet
+//
+// Inputs: channel / channel, time in us
+// Outputs: none
+//
+void Tach_edge(uint8_t ch);
+void Tach_edge_at(uint8_t ch, uint32_t now);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_poll
+//
+////////////////////////////////////////////////////////////////////
+//
+// Stops channels with no edge for longer than their timeout - period and
+// filter cleared. Call from a task at least as often as the shortest
+// timeout for the reading to drop to 0 on time
+//
+// Inputs: time in us
+// Outputs: none
+//
+void Tach_poll(uint32_t now);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Tach_period / Tach_last / Tach_rpm
+//
+////////////////////////////////////////////////////////////////////
+//
+// Tach_period - filtered period, Tach_last - the last period as measured
+// Tach_rpm - 60,000,000 / filtered period, rounded
+//
+// Inputs: channel
+// Outputs: us / RPM - 0 for a channel not running
+//
+uint32_t Tach_period(uint8_t ch);
+uint32_t Tach_last(uint8_t ch);
+uint32_t Tach_rpm(uint8_t ch);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_TACH_H__
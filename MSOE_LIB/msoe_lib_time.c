@@ -0,0 +1,188 @@
+/*
+ * msoe_lib_time.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     free running microsecond timebase on TIMER_A2
+ *      Rev:    0.2     follows SMCLK changes (Clock_notify)
+ *      Rev:    0.3     64 bit time past 2^48 us (overflow count carries)
+ *
+ */
+#ifndef __MSOE_LIB_TIME_C__
+#define __MSOE_LIB_TIME_C__
+////////////////////////////////////////////
+//
+// Timebase Routines - see msoe_lib_time.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msp432.h"
+#include "msoe_lib_clk.h"
+#include "msoe_lib_time.h"
+
+#define TIME_TIMER              TIMER_A2
+#define TIME_TIMER_IRQn         TA2_N_IRQn
+#define TIME_TIMER_IRQHandler   TA2_N_IRQHandler
+#define TIME_TAIFG              0x0001          // TAxCTL overflow flag
+#define TIME_TAIE               0x0002          // TAxCTL overflow interrupt enable
+#define TIME_TACLR              0x0004
+#define TIME_MC_CONTINUOUS      0x0020
+#define TIME_TASSEL_SMCLK       0x0200
+
+//
+// Overflows of the 16 bit count - the upper bits of the time in us
+// Time_top counts Time_hi wraps (every 2^48 us - ~8.9 years)
+//
+static volatile uint32_t Time_hi = 0;
+static volatile uint32_t Time_top = 0;
+static uint32_t Time_smclk = 0;             // SMCLK the timer is set for, 0 not started
+
+//
+// Local routines
+//
+uint64_t static Time_read(uint16_t *lo);
+uint8_t static Time_div(uint32_t smclk, uint8_t *id, uint8_t *ex);
+uint8_t static Time_clock(uint8_t when, const Clock_freq_t *next);
+
+////////////////////////////////////////////////////////////////////
+//
+// Time_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// SMCLK / 1MHz = ID (1, 2, 4, 8) x TAIDEX (1 to 8)
+// The smallest ID that works is taken
+// Registers with Clock_notify to follow SMCLK changes
+//
+int Time_Init(void){
+    uint8_t id;
+    uint8_t ex;
+
+    if(Time_div(Clock_SMCLK_freq, &id, &ex))
+        return 1;
+
+    TIME_TIMER->CTL = 0;                        // stop
+    Time_hi = 0;
+    Time_top = 0;
+    TIME_TIMER->EX0 = ex;
+    TIME_TIMER->CTL = TIME_TASSEL_SMCLK | (id << 6) | TIME_TACLR;
+    TIME_TIMER->CTL = TIME_TASSEL_SMCLK | (id << 6) | TIME_MC_CONTINUOUS | TIME_TAIE;
+    Time_smclk = Clock_SMCLK_freq;
+
+    NVIC->ISER[TIME_TIMER_IRQn >> 5] = 1UL << (TIME_TIMER_IRQn & 0x1F);
+    Clock_notify(Time_clock);
+    return 0;
+}
+
+uint8_t static Time_div(uint32_t smclk, uint8_t *id, uint8_t *ex){
+    uint32_t div = smclk / 1000000;
+
+    if(div == 0 || div * 1000000 != smclk)
+        return 1;
+    for(*id = 0; *id < 4; (*id)++)
+        if(div % (1U << *id) == 0 && div >> *id <= 8)
+            break;
+    if(*id == 4)
+        return 1;
+    *ex = (div >> *id) - 1;
+    return 0;
+}
+
+//
+// SMCLK change - refuse a frequency that cannot be divided to 1MHz
+// After the change the dividers are reloaded (they only load on TACLR,
+// which also clears the count) and the count is put back - the time
+// loses the part of a us in the prescaler
+// A pending overflow flag is kept for the interrupt
+//
+uint8_t static Time_clock(uint8_t when, const Clock_freq_t *next){
+    uint8_t id;
+    uint8_t ex;
+    uint16_t flag;
+    uint16_t lo;
+    uint32_t int_state;
+
+    if(Time_smclk == 0 || next->smclk == Time_smclk)
+        return 0;
+    if(when == CLOCK_BEFORE)
+        return Time_div(next->smclk, &id, &ex);
+    if(Time_div(next->smclk, &id, &ex))
+        return 0;                               // not reached - refused before
+
+    int_state = _disable_interrupts();
+    flag = TIME_TIMER->CTL & TIME_TAIFG;
+    lo = TIME_TIMER->R;
+    TIME_TIMER->CTL = TIME_TASSEL_SMCLK | (id << 6) | TIME_TACLR | flag;    // stop, reload dividers
+    TIME_TIMER->EX0 = ex;
+    TIME_TIMER->R = lo;
+    TIME_TIMER->CTL = TIME_TASSEL_SMCLK | (id << 6) | TIME_MC_CONTINUOUS | TIME_TAIE | flag;
+    Time_smclk = next->smclk;
+    _restore_interrupts(int_state);
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Time_now_us / Time_now_us64
+//
+////////////////////////////////////////////////////////////////////
+//
+// Read the overflow count and the timer until the count is stable (the
+// interrupt did not run in between)
+// A set overflow flag means the interrupt is pending (the caller has
+// interrupts off, or is a higher priority interrupt) - the count is one
+// behind when the timer value read is from after the overflow (small)
+// A large value was read before the overflow and goes with the old count
+// Time_top is read in the same loop - the interrupt changes it with
+// Time_hi (wrap to 0), so a stable Time_hi means a stable Time_top
+//
+uint64_t static Time_read(uint16_t *lo){
+    uint32_t hi;
+    uint32_t top;
+    uint16_t flag;
+
+    do{
+        hi = Time_hi;
+        top = Time_top;
+        *lo = TIME_TIMER->R;
+        flag = TIME_TIMER->CTL & TIME_TAIFG;
+    } while(hi != Time_hi);
+    return (((uint64_t)top << 32) | hi) + (flag && *lo < 0x8000);
+}
+
+uint32_t Time_now_us(void){
+    uint16_t lo;
+    uint32_t hi = (uint32_t)Time_read(&lo);
+    return (hi << 16) | lo;
+}
+
+uint64_t Time_now_us64(void){
+    uint16_t lo;
+    uint64_t hi = Time_read(&lo);
+    return (hi << 16) | lo;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// TIMER_A2 overflow interrupt
+//
+////////////////////////////////////////////////////////////////////
+//
+// The count and the flag change together - a higher priority interrupt
+// reading the time must not see one without the other
+//
+void TIME_TIMER_IRQHandler(void){
+    uint32_t int_state;
+
+    if(TIME_TIMER->CTL & TIME_TAIFG){
+        int_state = _disable_interrupts();
+        if(++Time_hi == 0)
+            Time_top++;
+        TIME_TIMER->CTL &= ~TIME_TAIFG;
+        _restore_interrupts(int_state);
+    }
+}
+
+#endif // __MSOE_LIB_TIME_C__
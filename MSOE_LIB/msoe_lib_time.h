@@ -0,0 +1,76 @@
+/*
+ * msoe_lib_time.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     free running microsecond timebase on TIMER_A2
+ *      Rev:    0.2     follows SMCLK changes (Clock_notify)
+ *      Rev:    0.3     64 bit time past 2^48 us (overflow count carries)
+ *
+ */
+#ifndef __MSOE_LIB_TIME_H__
+#define __MSOE_LIB_TIME_H__
+////////////////////////////////////////////
+//
+// Timebase Routines
+//
+// A monotonic microsecond clock for timestamps, latency and rate
+// measurements - TIMER_A2 counts SMCLK divided down to 1MHz and the
+// overflow interrupt (every 65.536ms) extends it to 32 and 64 bits
+//
+//      uint32_t t0 = now_us();
+//      ...
+//      elapsed = now_us() - t0;        // correct across the 2^32 wrap
+//
+// Reads are lock free (no interrupt disable) from the main loop and from
+// interrupts of any priority - an overflow not yet counted by its
+// interrupt is seen in the timer flag and counted by the read
+//
+// TIMER_A2 and TA2_N_IRQHandler belong to the timebase
+// SMCLK must be a whole number of MHz (1 to 64) and come from the same
+// source as MCLK (Clock_Init_48MHz - 12MHz from HFXT)
+// Clock_48MHz_Divide changes are followed (Clock_notify) - a divide that
+// leaves SMCLK not a whole number of MHz (/8 and slower) is refused
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////
+//
+// Time_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Starts the timebase at 0 from the SMCLK published by the clock module
+// (Clock_SMCLK_freq)
+//
+// Inputs: none
+// Outputs: 0 for success
+//          1 SMCLK cannot be divided to 1MHz (timebase not started)
+//
+int Time_Init(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Time_now_us / Time_now_us64 / now_us
+//
+////////////////////////////////////////////////////////////////////
+//
+// Microseconds since Time_Init
+// 32 bits wraps every ~71.6 minutes - differences of two readings are
+// still correct up to that span
+// 64 bits does not wrap (~585,000 years)
+//
+// Inputs: none
+// Outputs: time in us
+//
+uint32_t Time_now_us(void);
+uint64_t Time_now_us64(void);
+
+#define now_us()        Time_now_us()
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_TIME_H__
@@ -0,0 +1,313 @@
+/*
+ * msoe_lib_timer.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     hierarchical software timer wheel on one tick
+ *      Rev:    0.2     SysTick reload follows MCLK changes (Clock_notify)
+ *
+ */
+#ifndef __MSOE_LIB_TIMER_C__
+#define __MSOE_LIB_TIMER_C__
+////////////////////////////////////////////
+//
+// Software Timer Routines - see msoe_lib_timer.h
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+#include "msp432.h"
+#include "msoe_lib_timer.h"
+#include "msoe_lib_clk.h"
+
+//
+// Wheel geometry - 4 levels of 64 slots, level n slot covers 64^n ticks
+// List heads are level * 64 + slot, then the run list of the current tick
+//
+#define TIMER_LEVELS        4
+#define TIMER_BITS          6
+#define TIMER_SLOTS         (1 << TIMER_BITS)
+#define TIMER_MASK          (TIMER_SLOTS - 1)
+#define TIMER_RUN           (TIMER_LEVELS * TIMER_SLOTS)
+#define TIMER_NONE          0xFF            // end of list
+#define TIMER_IDLE          0xFFFF          // not in any list - free
+
+#if TIMER_MAX > 127
+#error "TIMER_MAX must be 127 or less - ids are int8_t"
+#endif
+
+//
+// Timers are linked into the slot lists (and the free list) by index
+//
+typedef struct {
+    void (*cb)(void);
+    uint32_t expires;                       // tick the callback runs on
+    uint32_t period;                        // 0 - one shot
+    uint8_t next;
+    uint8_t prev;
+    uint16_t slot;                          // list head index, TIMER_IDLE when free
+} Timer_t;
+
+static Timer_t Timer_pool[TIMER_MAX];
+static uint8_t Timer_wheel[TIMER_RUN + 1];                 // list heads
+static uint8_t Timer_free = TIMER_NONE;
+static volatile uint32_t Timer_jiffies = 0;                // next tick to run
+static uint8_t Timer_ready = 0;
+static uint32_t Timer_tick_hz = 0;                        // SysTick tick rate, 0 - Timer_tick only
+
+//
+// Local routines
+//
+void static Timer_reset(void);
+void static Timer_add(uint8_t id);
+void static Timer_link(uint8_t id, uint16_t slot);
+void static Timer_del(uint8_t id);
+uint8_t static Timer_cascade(uint8_t level, uint8_t index);
+uint8_t static Timer_clock(uint8_t when, const Clock_freq_t *next);
+
+////////////////////////////////////////////////////////////////////
+//
+// Wheel lists
+//
+////////////////////////////////////////////////////////////////////
+//
+// Clear the wheel and put every timer on the free list
+//
+void static Timer_reset(void){
+    uint16_t i;
+    for(i = 0; i <= TIMER_RUN; i++)
+        Timer_wheel[i] = TIMER_NONE;
+    for(i = 0; i < TIMER_MAX; i++){
+        Timer_pool[i].slot = TIMER_IDLE;
+        Timer_pool[i].next = (i + 1 < TIMER_MAX) ? i + 1 : TIMER_NONE;
+    }
+    Timer_free = 0;
+    Timer_jiffies = 0;
+    Timer_ready = 1;
+}
+//
+// Put a timer in the slot for its expiry - the finest level that reaches it
+// A timer already due (expiry behind the wheel) goes in the next slot to run
+//
+void static Timer_add(uint8_t id){
+    Timer_t *t = &Timer_pool[id];
+    uint32_t delta = t->expires - Timer_jiffies;
+    uint16_t slot;
+
+    if((int32_t)delta < 0)
+        slot = Timer_jiffies & TIMER_MASK;
+    else if(delta < (1UL << TIMER_BITS))
+        slot = t->expires & TIMER_MASK;
+    else if(delta < (1UL << (2 * TIMER_BITS)))
+        slot = 1 * TIMER_SLOTS + ((t->expires >> TIMER_BITS) & TIMER_MASK);
+    else if(delta < (1UL << (3 * TIMER_BITS)))
+        slot = 2 * TIMER_SLOTS + ((t->expires >> (2 * TIMER_BITS)) & TIMER_MASK);
+    else
+        slot = 3 * TIMER_SLOTS + ((t->expires >> (3 * TIMER_BITS)) & TIMER_MASK);
+    Timer_link(id, slot);
+}
+void static Timer_link(uint8_t id, uint16_t slot){
+    Timer_t *t = &Timer_pool[id];
+    t->slot = slot;
+    t->prev = TIMER_NONE;
+    t->next = Timer_wheel[slot];
+    if(t->next != TIMER_NONE)
+        Timer_pool[t->next].prev = id;
+    Timer_wheel[slot] = id;
+}
+void static Timer_del(uint8_t id){
+    Timer_t *t = &Timer_pool[id];
+    if(t->prev == TIMER_NONE)
+        Timer_wheel[t->slot] = t->next;
+    else
+        Timer_pool[t->prev].next = t->next;
+    if(t->next != TIMER_NONE)
+        Timer_pool[t->next].prev = t->prev;
+    t->slot = TIMER_IDLE;
+}
+//
+// Move every timer in a coarse slot down to the finer levels
+// Returns the slot index - 0 means the next level up is due as well
+//
+uint8_t static Timer_cascade(uint8_t level, uint8_t index){
+    uint8_t id = Timer_wheel[level * TIMER_SLOTS + index];
+    uint8_t next;
+    Timer_wheel[level * TIMER_SLOTS + index] = TIMER_NONE;
+    while(id != TIMER_NONE){
+        next = Timer_pool[id].next;
+        Timer_add(id);
+        id = next;
+    }
+    return index;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_Init
+//
+////////////////////////////////////////////////////////////////////
+void Timer_Init(uint32_t mclk_hz, uint32_t tick_hz){
+    uint32_t int_state = _disable_interrupts();
+    Timer_reset();
+    _restore_interrupts(int_state);
+
+    SysTick->CTRL = 0x0000;                 // stop while reprogramming
+    SysTick->LOAD = mclk_hz / tick_hz - 1;
+    SysTick->VAL = 0x0;
+    SysTick->CTRL = 0x0007;                 // CPU clk (bit 2), interrupt (bit 1), enable (bit 0)
+    Timer_tick_hz = tick_hz;
+    Clock_notify(Timer_clock);
+}
+
+//
+// MCLK change (Clock_notify) - SysTick counts MCLK, the reload follows so
+// the tick rate stays the same. Refused if the reload would not fit in
+// 24 bits (or be under 2). The tick in progress when MCLK changes is
+// restarted - at most one tick is stretched
+//
+uint8_t static Timer_clock(uint8_t when, const Clock_freq_t *next){
+    uint32_t load;
+
+    if(Timer_tick_hz == 0 || !(SysTick->CTRL & 0x0001))
+        return 0;
+    load = next->mclk / Timer_tick_hz;
+    if(when == CLOCK_BEFORE)
+        return load < 2 || load > 0x01000000UL;
+    if(SysTick->LOAD != load - 1){
+        SysTick->LOAD = load - 1;
+        SysTick->VAL = 0x0;
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_start
+//
+////////////////////////////////////////////////////////////////////
+int8_t Timer_start(void (*cb)(void), uint32_t period, uint8_t oneshot){
+    uint32_t int_state;
+    uint8_t id;
+
+    if(cb == 0 || period == 0 || period > TIMER_PERIOD_MAX)
+        return -1;
+
+    int_state = _disable_interrupts();
+    if(!Timer_ready)                        // driven by Timer_tick without Timer_Init
+        Timer_reset();
+    id = Timer_free;
+    if(id == TIMER_NONE){
+        _restore_interrupts(int_state);
+        return -1;
+    }
+    Timer_free = Timer_pool[id].next;
+    Timer_pool[id].cb = cb;
+    Timer_pool[id].period = oneshot ? 0 : period;
+    Timer_pool[id].expires = Timer_jiffies + period - 1;
+    Timer_add(id);
+    _restore_interrupts(int_state);
+    return (int8_t)id;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_stop
+//
+////////////////////////////////////////////////////////////////////
+void Timer_stop(int8_t id){
+    uint32_t int_state;
+
+    if(id < 0 || id >= TIMER_MAX)
+        return;
+    int_state = _disable_interrupts();
+    if(Timer_pool[id].slot != TIMER_IDLE){  // running
+        Timer_del((uint8_t)id);
+        Timer_pool[id].next = Timer_free;
+        Timer_free = (uint8_t)id;
+    }
+    _restore_interrupts(int_state);
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_tick
+//
+////////////////////////////////////////////////////////////////////
+//
+// 1) When level 0 wraps, move the next level 1 slot down (and level 2, 3
+//    when they wrap as well)
+// 2) Move the level 0 slot for this tick (every timer in it is due) to the
+//    run list and run it - a timer put back in the wheel (periodic) or
+//    started by a callback waits for its own tick even when it lands in
+//    this slot again
+//    Periodic timers are put back before their callback runs so the
+//    callback can stop them; interrupts are enabled during callbacks
+//
+void Timer_tick(void){
+    uint32_t int_state = _disable_interrupts();
+    uint32_t j;
+    uint8_t index;
+    uint8_t id;
+    uint8_t next;
+    void (*cb)(void);
+
+    if(!Timer_ready)
+        Timer_reset();
+    j = Timer_jiffies;
+    index = j & TIMER_MASK;
+    if(index == 0
+       && Timer_cascade(1, (j >> TIMER_BITS) & TIMER_MASK) == 0
+       && Timer_cascade(2, (j >> (2 * TIMER_BITS)) & TIMER_MASK) == 0)
+        Timer_cascade(3, (j >> (3 * TIMER_BITS)) & TIMER_MASK);
+    Timer_jiffies = j + 1;
+
+    id = Timer_wheel[index];
+    Timer_wheel[index] = TIMER_NONE;
+    while(id != TIMER_NONE){
+        next = Timer_pool[id].next;
+        Timer_link(id, TIMER_RUN);
+        id = next;
+    }
+    while((id = Timer_wheel[TIMER_RUN]) != TIMER_NONE){
+        Timer_del(id);
+        cb = Timer_pool[id].cb;
+        if(Timer_pool[id].period){
+            Timer_pool[id].expires += Timer_pool[id].period;
+            Timer_add(id);
+        }
+        else{
+            Timer_pool[id].next = Timer_free;
+            Timer_free = id;
+        }
+        _restore_interrupts(int_state);
+        cb();
+        int_state = _disable_interrupts();
+    }
+    _restore_interrupts(int_state);
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_now / Timer_wait
+//
+////////////////////////////////////////////////////////////////////
+uint32_t Timer_now(void){
+    return Timer_jiffies;
+}
+void Timer_wait(uint32_t ticks){
+    uint32_t start = Timer_jiffies;
+    while(Timer_jiffies - start < ticks)
+        ;
+}
+
+////////////////////////////////////////////////////////////////////
+//
+// SysTick interrupt - the wheel tick after Timer_Init
+//
+////////////////////////////////////////////////////////////////////
+void SysTick_Handler(void){
+    Timer_tick();
+}
+
+#endif // __MSOE_LIB_TIMER_C__
@@ -0,0 +1,146 @@
+/*
+ * msoe_lib_timer.h
+ *
+ *  Created on: Oct 17, 2026
+ *
+ *      Rev:    0.1     hierarchical software timer wheel on one tick
+ *      Rev:    0.2     SysTick reload follows MCLK changes (Clock_notify)
+ *
+ */
+#ifndef __MSOE_LIB_TIMER_H__
+#define __MSOE_LIB_TIMER_H__
+////////////////////////////////////////////
+//
+// Software Timer Routines
+//
+// Many periodic or one shot jobs (display refresh, speed averaging, sensor
+// timeout ...) share one hardware tick - SysTick by default (Timer_Init),
+// or any timer interrupt that calls Timer_tick
+//
+// Timers sit in a 4 level wheel of 64 slots per level
+//      level 0 - expiring in the next 64 ticks, one slot per tick
+//      level 1 - the next 64 x 64 ticks, one slot per 64 ticks
+//      level 2, 3 - 64 times coarser again
+// Each tick runs one level 0 slot - every 64 ticks the next coarser slot is
+// moved down a level. Start, stop and the tick are O(1) per timer
+//
+// Callbacks run in the tick interrupt - keep them short, set a flag or
+// queue work for the main loop for anything long
+// The SysTick delay routines (msoe_lib_delay) reprogram SysTick - use
+// Timer_wait instead once Timer_Init has been called
+//
+////////////////////////////////////////////
+//
+// Includes
+#include <stdint.h>
+
+//
+// Number of timers that can run at once
+//
+#if !defined(TIMER_MAX)
+#define TIMER_MAX           16
+#endif
+
+//
+// Longest period in ticks (~4.6 hours with a 1ms tick)
+//
+#define TIMER_PERIOD_MAX    0x00FFFFFFUL
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_Init
+//
+////////////////////////////////////////////////////////////////////
+//
+// Programs SysTick to interrupt tick_hz times a second from the CPU clock
+// and clears all timers - e.g. Timer_Init(48000000, 1000) for a 1ms tick
+// at 48MHz
+// mclk_hz / tick_hz must be 2 to 16,777,216
+// The tick rate is kept across Clock_48MHz_Divide - a divide that would
+// take the reload out of range is refused
+//
+// Inputs: CPU clock frequency, tick frequency
+// Outputs: none
+//
+void Timer_Init(uint32_t mclk_hz, uint32_t tick_hz);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_start
+//
+////////////////////////////////////////////////////////////////////
+//
+// The callback runs period ticks from now (the first tick after the call
+// counts as 1) and then every period ticks unless oneshot is 1
+// Periodic timers do not drift - each expiry is period ticks after the last
+//
+// May be called from a callback (including to restart the same job)
+//
+// Inputs: callback, period in ticks (1 to TIMER_PERIOD_MAX), oneshot
+// Outputs: timer id (0 to TIMER_MAX - 1), -1 if no timer is free or
+//          the period is out of range
+//
+int8_t Timer_start(void (*cb)(void), uint32_t period, uint8_t oneshot);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_stop
+//
+////////////////////////////////////////////////////////////////////
+//
+// Stops a running timer - a periodic timer may stop itself from its callback
+// The id is free for reuse once stopped (or once a one shot timer runs),
+// so only stop timers that are still running
+//
+// Inputs: timer id from Timer_start
+// Outputs: none
+//
+void Timer_stop(int8_t id);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_tick
+//
+////////////////////////////////////////////////////////////////////
+//
+// Advances the wheel one tick and runs the callbacks that are due
+// Called by SysTick_Handler after Timer_Init - call it from another timer
+// interrupt instead to drive the wheel from that timer
+//
+// Inputs: none
+// Outputs: none
+//
+void Timer_tick(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_now
+//
+////////////////////////////////////////////////////////////////////
+//
+// Inputs: none
+// Outputs: ticks since Timer_Init (wraps at 2^32)
+//
+uint32_t Timer_now(void);
+////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////
+//
+// Timer_wait
+//
+////////////////////////////////////////////////////////////////////
+//
+// Waits for ticks ticks - interrupts and timer callbacks keep running
+// Do not call from a callback
+//
+// Inputs: ticks to wait
+// Outputs: none
+//
+void Timer_wait(uint32_t ticks);
+////////////////////////////////////////////////////////////////////
+
+#endif // __MSOE_LIB_TIMER_H__
@@ -0,0 +1,30 @@
+/*
+ * pu1_rle.h
+ *
+ *  Generated by host/bmp_rle_gen.c from pu1.h - 504 bytes run length encoded to 172
+ *  - do not edit, rerun the generator instead
+ *
+ */
+#ifndef __MSOE_LIB_PU1_RLE_H__
+#define __MSOE_LIB_PU1_RLE_H__
+////////////////////////////////////
+//
+// pu1.h for LCD_print_bmpRLE
+//
+////////////////////////////////////
+#include <stdint.h>
+
+static const uint8_t pu1_rle [] = {
+  0x8E,0x00,0x02,0x80,0xE0,0xF8,0x82,0xFF,0xB1,0x3F,0x09,0x3E,0x7E,0x7E,0xFE,0xFC,
+  0xFC,0xF8,0xF0,0xE0,0xC0,0x8B,0x00,0x02,0xC0,0xF0,0xFC,0x82,0xFF,0x01,0xCF,0xC3,
+  0x84,0xC0,0x8E,0x00,0x00,0x80,0x90,0xC0,0x8D,0x00,0x00,0x81,0x83,0xFF,0x8A,0x00,
+  0x00,0x0E,0x84,0x0F,0x00,0xEF,0x83,0xFF,0x02,0x3F,0x0F,0x01,0x8C,0x00,0x01,0x10,
+  0x1C,0x8E,0x1F,0x80,0x0F,0x00,0x03,0x89,0x00,0x03,0x80,0xE0,0xF0,0xFE,0x81,0xFF,
+  0x02,0x3F,0x0F,0x03,0x85,0x00,0x00,0xE0,0x87,0xF0,0x00,0xFC,0x82,0xFF,0x02,0x1F,
+  0x07,0x01,0x8B,0x00,0x00,0xC0,0x98,0xE0,0x82,0xF0,0x80,0xF8,0x09,0xFC,0xFE,0xFF,
+  0x7F,0x3F,0x1F,0x1F,0x0F,0x03,0x01,0x84,0x00,0x02,0x80,0xE0,0xFC,0x82,0xFF,0x00,
+  0x1F,0x87,0x07,0x00,0x03,0x8E,0x00,0x00,0x06,0x84,0x07,0x00,0xE7,0x83,0xFF,0x00,
+  0x3F,0x8E,0x07,0x81,0x03,0x80,0x01,0x8A,0x00,0x02,0x80,0xF0,0xFC,0x83,0xFF,0x00,
+  0xFB,0x9F,0xF8,0x00,0xFC,0x82,0xFF,0x01,0x1F,0x07,0xA1,0x00 };
+
+#endif // __MSOE_LIB_PU1_RLE_H__
@@ -0,0 +1,22 @@
+/*
+ * test_bmp_rle.h
+ *
+ *  Generated by host/bmp_rle_gen.c from test_bmp.h - 504 bytes run length encoded to 40
+ *  - do not edit, rerun the generator instead
+ *
+ */
+#ifndef __MSOE_LIB_TEST_BMP_RLE_H__
+#define __MSOE_LIB_TEST_BMP_RLE_H__
+////////////////////////////////////
+//
+// test_bmp.h for LCD_print_bmpRLE
+//
+////////////////////////////////////
+#include <stdint.h>
+
+static const uint8_t test_bmp_rle [] = {
+  0x97,0x3F,0x97,0x00,0x85,0xFC,0x98,0x00,0x00,0x03,0xA7,0xF0,0x87,0x00,0x85,0xFF,
+  0x99,0x00,0xA7,0x1F,0x87,0x00,0x85,0xFF,0xCB,0x00,0x85,0xFF,0xCB,0x00,0x85,0x0F,
+  0x99,0x00,0x81,0xC0,0xC7,0x00,0x86,0xFF };
+
+#endif // __MSOE_LIB_TEST_BMP_RLE_H__